@@ -0,0 +1,160 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BlueprintAssistFormatters/BAFormatGeometry.h"
+
+#include "BlueprintAssistGraphHandler.h"
+#include "BlueprintAssistStats.h"
+#include "EdGraph/EdGraphNode.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("FormatGeometry Nodes"), STAT_FormatGeometry_Nodes, STATGROUP_BA_EdGraphFormatter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FormatGeometry Pins"), STAT_FormatGeometry_Pins, STATGROUP_BA_EdGraphFormatter);
+
+void FBAFormatGeometry::Init(TSharedPtr<FBAGraphHandler> InGraphHandler)
+{
+	Reset();
+	GraphHandler = InGraphHandler;
+}
+
+void FBAFormatGeometry::Reset()
+{
+	NodeIds.Reset();
+	PinIds.Reset();
+	Nodes.Reset();
+	NodeSizes.Reset();
+	CommentBubbleSizes.Reset();
+	Pins.Reset();
+	PinGuids.Reset();
+	PinNodeIds.Reset();
+	PinOffsets.Reset();
+}
+
+int32 FBAFormatGeometry::GetNodeId(UEdGraphNode* Node)
+{
+	if (!Node)
+	{
+		return InvalidId;
+	}
+
+	if (const int32* FoundId = NodeIds.Find(Node))
+	{
+		return *FoundId;
+	}
+
+	TSharedPtr<FBAGraphHandler> GraphHandlerPtr = GraphHandler.Pin();
+	if (!GraphHandlerPtr.IsValid())
+	{
+		return InvalidId;
+	}
+
+	const int32 NodeId = Nodes.Add(Node);
+	NodeSizes.Add(GraphHandlerPtr->CalculateNodeSize(Node));
+	CommentBubbleSizes.Add(GraphHandlerPtr->GetCommentBubbleSize(Node));
+	NodeIds.Add(Node, NodeId);
+
+	INC_DWORD_STAT(STAT_FormatGeometry_Nodes);
+	return NodeId;
+}
+
+int32 FBAFormatGeometry::GetPinId(const UEdGraphPin* Pin)
+{
+	if (!Pin)
+	{
+		return InvalidId;
+	}
+
+	const int32* FoundId = PinIds.Find(Pin);
+
+	// pins aren't uobjects, a knot removed by the formatter can free a pin whose memory gets reused by a new one
+	if (FoundId && PinGuids[*FoundId] == Pin->PinId)
+	{
+		return *FoundId;
+	}
+
+	const int32 NodeId = GetNodeId(Pin->GetOwningNode());
+	if (NodeId == InvalidId)
+	{
+		return InvalidId;
+	}
+
+	// pins without a cached offset or widget sit at the top of their node, same as FBAGraphHandler::GetPinY
+	float PinOffset = 0.0f;
+	GraphHandler.Pin()->CalculatePinOffset(Pin, PinOffset);
+
+	const int32 PinId = Pins.Add(Pin);
+	PinGuids.Add(Pin->PinId);
+	PinNodeIds.Add(NodeId);
+	PinOffsets.Add(PinOffset);
+	PinIds.Add(Pin, PinId);
+
+	INC_DWORD_STAT(STAT_FormatGeometry_Pins);
+	return PinId;
+}
+
+FSlateRect FBAFormatGeometry::GetNodeBounds(int32 NodeId, bool bWithCommentBubble) const
+{
+	const UEdGraphNode* Node = Nodes[NodeId];
+
+	FVector2D Pos(Node->NodePosX, Node->NodePosY);
+	FIntPoint Size = NodeSizes[NodeId];
+
+	if (bWithCommentBubble && Node->bCommentBubbleVisible)
+	{
+		const FIntPoint& BubbleSize = CommentBubbleSizes[NodeId];
+		Pos.Y -= BubbleSize.Y;
+		Size.Y += BubbleSize.Y;
+		Size.X = FMath::Max(Size.X, BubbleSize.X);
+	}
+
+	return FSlateRect::FromPointAndExtent(Pos, Size);
+}
+
+FSlateRect FBAFormatGeometry::GetNodeBounds(UEdGraphNode* Node, bool bWithCommentBubble)
+{
+	const int32 NodeId = GetNodeId(Node);
+	return NodeId != InvalidId ? GetNodeBounds(NodeId, bWithCommentBubble) : FSlateRect();
+}
+
+int32 FBAFormatGeometry::GetPinY(int32 PinId) const
+{
+	return FMath::RoundToInt(Nodes[PinNodeIds[PinId]]->NodePosY + PinOffsets[PinId]);
+}
+
+int32 FBAFormatGeometry::GetPinY(const UEdGraphPin* Pin)
+{
+	const int32 PinId = GetPinId(Pin);
+	return PinId != InvalidId ? GetPinY(PinId) : 0;
+}
+
+FVector2D FBAFormatGeometry::GetPinPos(int32 PinId) const
+{
+	const UEdGraphNode* Node = Nodes[PinNodeIds[PinId]];
+	const FIntPoint& Size = NodeSizes[PinNodeIds[PinId]];
+
+	// use node left and right for the pin pos x
+	return FVector2D(
+		Pins[PinId]->Direction == EGPD_Input ? Node->NodePosX : Node->NodePosX + Size.X,
+		GetPinY(PinId));
+}
+
+FVector2D FBAFormatGeometry::GetPinPos(const UEdGraphPin* Pin)
+{
+	const int32 PinId = GetPinId(Pin);
+	return PinId != InvalidId ? GetPinPos(PinId) : FVector2D::ZeroVector;
+}
+
+FBAFormatGeometryScope::FBAFormatGeometryScope(TSharedPtr<FBAGraphHandler> InGraphHandler)
+	: GraphHandler(InGraphHandler)
+{
+	if (GraphHandler.IsValid())
+	{
+		GraphHandler->BeginFormatGeometry();
+	}
+}
+
+FBAFormatGeometryScope::~FBAFormatGeometryScope()
+{
+	if (GraphHandler.IsValid())
+	{
+		GraphHandler->EndFormatGeometry();
+	}
+}
@@ -0,0 +1,325 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BlueprintAssistFormatters/BAGraphAdjacency.h"
+
+#include "BlueprintAssistGlobals.h"
+#include "BlueprintAssistGraphHandler.h"
+#include "BlueprintAssistStats.h"
+#include "BlueprintAssistTabHandler.h"
+#include "BlueprintAssistUtils.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("GraphAdjacency Links"), STAT_GraphAdjacency_Links, STATGROUP_BA_EdGraphFormatter);
+
+void FBAGraphAdjacency::Build(UEdGraphNode* RootNode)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FBAGraphAdjacency::Build"), STAT_GraphAdjacency_Build, STATGROUP_BA_EdGraphFormatter);
+
+	Reset();
+
+	if (!RootNode)
+	{
+		return;
+	}
+
+	// gather every node reachable from the root, links are followed from visible pins like FBAUtils::GetLinkedPins
+	NodeIds.Add(RootNode, 0);
+	Nodes.Add(RootNode);
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		for (UEdGraphPin* Pin : Nodes[NodeIndex]->Pins)
+		{
+			if (FBAUtils::IsPinHidden(Pin))
+			{
+				continue;
+			}
+
+			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				UEdGraphNode* LinkedNode = LinkedPin->GetOwningNodeUnchecked();
+				if (LinkedNode && !NodeIds.Contains(LinkedNode))
+				{
+					NodeIds.Add(LinkedNode, Nodes.Add(LinkedNode));
+				}
+			}
+		}
+	}
+
+	// fill the buckets, each node's pins are classified once and then emitted per bucket to keep pin order inside a bucket
+	BucketOffsets.Reserve(Nodes.Num() * NumBucketsPerNode + 1);
+	BucketOffsets.Add(0);
+
+	TArray<TPair<UEdGraphPin*, int32>, TInlineAllocator<32>> PinBuckets;
+	for (int32 NodeId = 0; NodeId < Nodes.Num(); ++NodeId)
+	{
+		PinBuckets.Reset();
+		for (UEdGraphPin* Pin : Nodes[NodeId]->Pins)
+		{
+			if (Pin->LinkedTo.Num() > 0 && !FBAUtils::IsPinHidden(Pin))
+			{
+				PinBuckets.Add(TPair<UEdGraphPin*, int32>(Pin, GetBucketIndex(NodeId, Pin->Direction, GetLinkKind(Pin))));
+			}
+		}
+
+		for (int32 Bucket = NodeId * NumBucketsPerNode; Bucket < (NodeId + 1) * NumBucketsPerNode; ++Bucket)
+		{
+			for (const TPair<UEdGraphPin*, int32>& PinBucket : PinBuckets)
+			{
+				if (PinBucket.Value != Bucket)
+				{
+					continue;
+				}
+
+				for (UEdGraphPin* LinkedPin : PinBucket.Key->LinkedTo)
+				{
+					if (const int32* ToNodeId = NodeIds.Find(LinkedPin->GetOwningNodeUnchecked()))
+					{
+						FBAAdjacencyLink& Link = Links.AddDefaulted_GetRef();
+						Link.From = PinBucket.Key;
+						Link.To = LinkedPin;
+						Link.ToNodeId = *ToNodeId;
+					}
+				}
+			}
+
+			BucketOffsets.Add(Links.Num());
+		}
+	}
+
+	VisitStamps.SetNumZeroed(Nodes.Num());
+	WalkQueue.Reserve(Nodes.Num());
+
+	SET_DWORD_STAT(STAT_GraphAdjacency_Links, Links.Num());
+}
+
+void FBAGraphAdjacency::Reset()
+{
+	NodeIds.Reset();
+	Nodes.Reset();
+	BucketOffsets.Reset();
+	Links.Reset();
+	VisitStamps.Reset();
+	CurrentStamp = 0;
+	WalkQueue.Reset();
+}
+
+EBALinkKind FBAGraphAdjacency::GetLinkKind(const UEdGraphPin* Pin)
+{
+	if (FBAUtils::IsExecPin(Pin))
+	{
+		return EBALinkKind::Exec;
+	}
+
+	if (FBAUtils::IsDelegatePin(Pin))
+	{
+		return EBALinkKind::Delegate;
+	}
+
+	return EBALinkKind::Parameter;
+}
+
+uint32 FBAGraphAdjacency::BeginVisit() const
+{
+	// stamps avoid clearing a visited array for every walk, only wrap around needs a reset
+	if (++CurrentStamp == 0)
+	{
+		FMemory::Memzero(VisitStamps.GetData(), VisitStamps.Num() * sizeof(uint32));
+		CurrentStamp = 1;
+	}
+
+	WalkQueue.Reset();
+	return CurrentStamp;
+}
+
+template<typename FuncType, typename FilterType>
+bool FBAGraphAdjacency::WalkTree(int32 InitialId, EBALinkKindMask Mask, EEdGraphPinDirection Direction, bool bOnlyInitialDirection, FuncType Visit, FilterType LinkFilter) const
+{
+	const uint32 Stamp = BeginVisit();
+
+	VisitStamps[InitialId] = Stamp;
+	WalkQueue.Add(InitialId);
+
+	for (int32 QueueIndex = 0; QueueIndex < WalkQueue.Num(); ++QueueIndex)
+	{
+		const int32 NodeId = WalkQueue[QueueIndex];
+		if (!Visit(NodeId))
+		{
+			return false;
+		}
+
+		const EEdGraphPinDirection PinsDirection = bOnlyInitialDirection && NodeId != InitialId ? EGPD_MAX : Direction;
+
+		ForEachLink(NodeId, PinsDirection, Mask, [&](const FBAAdjacencyLink& Link)
+		{
+			if (VisitStamps[Link.ToNodeId] != Stamp && LinkFilter(Link))
+			{
+				VisitStamps[Link.ToNodeId] = Stamp;
+				WalkQueue.Add(Link.ToNodeId);
+			}
+		});
+	}
+
+	return true;
+}
+
+void FBAGraphAdjacency::GetNodeTree(UEdGraphNode* InitialNode, TArray<UEdGraphNode*>& OutNodes, EBALinkKindMask Mask, EEdGraphPinDirection Direction, bool bOnlyInitialDirection) const
+{
+	OutNodes.Reset();
+
+	const int32 InitialId = GetNodeId(InitialNode);
+	if (InitialId == INDEX_NONE)
+	{
+		if (InitialNode)
+		{
+			OutNodes.Add(InitialNode);
+		}
+
+		return;
+	}
+
+	WalkTree(InitialId, Mask, Direction, bOnlyInitialDirection, [&](int32 NodeId)
+	{
+		OutNodes.Add(Nodes[NodeId]);
+		return true;
+	}, [](const FBAAdjacencyLink&) { return true; });
+}
+
+void FBAGraphAdjacency::GetNodeTreeWithFilter(UEdGraphNode* InitialNode, TArray<UEdGraphNode*>& OutNodes, TFunctionRef<bool(const FBAAdjacencyLink&)> LinkFilter, EEdGraphPinDirection Direction, bool bOnlyInitialDirection) const
+{
+	OutNodes.Reset();
+
+	const int32 InitialId = GetNodeId(InitialNode);
+	if (InitialId == INDEX_NONE)
+	{
+		if (InitialNode)
+		{
+			OutNodes.Add(InitialNode);
+		}
+
+		return;
+	}
+
+	WalkTree(InitialId, EBALinkKindMask::All, Direction, bOnlyInitialDirection, [&](int32 NodeId)
+	{
+		OutNodes.Add(Nodes[NodeId]);
+		return true;
+	}, LinkFilter);
+}
+
+void FBAGraphAdjacency::GetExecTree(UEdGraphNode* InitialNode, TArray<UEdGraphNode*>& OutNodes, EEdGraphPinDirection Direction) const
+{
+	GetNodeTree(InitialNode, OutNodes, EBALinkKindMask::Exec, Direction);
+}
+
+bool FBAGraphAdjacency::IsInTree(UEdGraphNode* InitialNode, const UEdGraphNode* Target, EBALinkKindMask Mask, EEdGraphPinDirection Direction) const
+{
+	const int32 InitialId = GetNodeId(InitialNode);
+	const int32 TargetId = GetNodeId(Target);
+	if (InitialId == INDEX_NONE || TargetId == INDEX_NONE)
+	{
+		return InitialNode != nullptr && InitialNode == Target;
+	}
+
+	const bool bFinished = WalkTree(InitialId, Mask, Direction, false, [TargetId](int32 NodeId)
+	{
+		return NodeId != TargetId;
+	}, [](const FBAAdjacencyLink&) { return true; });
+
+	return !bFinished;
+}
+
+void FBAGraphAdjacency::GetLinkedNodes(UEdGraphNode* Node, TArray<UEdGraphNode*>& OutNodes, EBALinkKindMask Mask, EEdGraphPinDirection Direction) const
+{
+	OutNodes.Reset();
+
+	const int32 NodeId = GetNodeId(Node);
+	if (NodeId == INDEX_NONE)
+	{
+		return;
+	}
+
+	const uint32 Stamp = BeginVisit();
+	ForEachLink(NodeId, Direction, Mask, [&](const FBAAdjacencyLink& Link)
+	{
+		if (VisitStamps[Link.ToNodeId] != Stamp)
+		{
+			VisitStamps[Link.ToNodeId] = Stamp;
+			OutNodes.Add(Nodes[Link.ToNodeId]);
+		}
+	});
+}
+
+namespace BAGraphAdjacencyBenchmark
+{
+	/** Times the exec tree of every node in the focused graph with FBAUtils and with FBAGraphAdjacency */
+	static void Run(const TArray<FString>& Args)
+	{
+		TSharedPtr<FBAGraphHandler> GraphHandler = FBATabHandler::Get().GetActiveGraphHandler();
+		UEdGraph* Graph = GraphHandler.IsValid() ? GraphHandler->GetFocusedEdGraph() : nullptr;
+		if (!Graph || Graph->Nodes.Num() == 0)
+		{
+			UE_LOG(LogBlueprintAssist, Warning, TEXT("BlueprintAssist.BenchmarkTraversal: open a graph first"));
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1;
+
+		double UtilsTime = 0.0;
+		double AdjacencyTime = 0.0;
+		double BuildTime = 0.0;
+		int32 UtilsVisited = 0;
+		int32 AdjacencyVisited = 0;
+
+		FBAGraphAdjacency Adjacency;
+		TArray<UEdGraphNode*> Tree;
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node)
+				{
+					continue;
+				}
+
+				double StartTime = FPlatformTime::Seconds();
+				UtilsVisited += FBAUtils::GetExecTree(Node, EGPD_Input).Num();
+				UtilsVisited += FBAUtils::GetNodeTree(Node).Num();
+				UtilsTime += FPlatformTime::Seconds() - StartTime;
+
+				StartTime = FPlatformTime::Seconds();
+				if (Adjacency.GetNodeId(Node) == INDEX_NONE)
+				{
+					Adjacency.Build(Node);
+					BuildTime += FPlatformTime::Seconds() - StartTime;
+					StartTime = FPlatformTime::Seconds();
+				}
+
+				Adjacency.GetExecTree(Node, Tree, EGPD_Input);
+				AdjacencyVisited += Tree.Num();
+				Adjacency.GetNodeTree(Node, Tree);
+				AdjacencyVisited += Tree.Num();
+				AdjacencyTime += FPlatformTime::Seconds() - StartTime;
+			}
+
+			Adjacency.Reset();
+		}
+
+		UE_LOG(LogBlueprintAssist, Log, TEXT("BlueprintAssist.BenchmarkTraversal: %d nodes x %d iterations"), Graph->Nodes.Num(), Iterations);
+		UE_LOG(LogBlueprintAssist, Log, TEXT("\tFBAUtils: %.3f ms (%d nodes visited)"), UtilsTime * 1000.0, UtilsVisited);
+		UE_LOG(LogBlueprintAssist, Log, TEXT("\tFBAGraphAdjacency: %.3f ms + %.3f ms build (%d nodes visited)"), AdjacencyTime * 1000.0, BuildTime * 1000.0, AdjacencyVisited);
+
+		if (UtilsVisited != AdjacencyVisited)
+		{
+			UE_LOG(LogBlueprintAssist, Warning, TEXT("\tTraversals visited a different number of nodes"));
+		}
+	}
+
+	static FAutoConsoleCommand CmdBenchmarkTraversal(
+		TEXT("BlueprintAssist.BenchmarkTraversal"),
+		TEXT("Compares FBAUtils node tree traversal against FBAGraphAdjacency on the focused graph. Optional arg: number of iterations"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
@@ -19,7 +19,7 @@ FBehaviorTreeGraphFormatter::FBehaviorTreeGraphFormatter(
 void FBehaviorTreeGraphFormatter::FormatNode(UEdGraphNode* InNode)
 {
 	RootNode = InNode;
-	RootNode->Modify();
+	GraphHandler->ModifyNodeForMove(RootNode);
 
 	while (true)
 	{
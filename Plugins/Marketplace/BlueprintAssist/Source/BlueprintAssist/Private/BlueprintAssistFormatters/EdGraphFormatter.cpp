@@ -11,6 +11,7 @@
 #include "SGraphNodeComment.h"
 #include "SGraphPanel.h"
 #include "Algo/Transform.h"
+#include "BlueprintAssistFormatters/BAGraphAdjacency.h"
 #include "BlueprintAssistFormatters/BlueprintAssistCommentContainsGraph.h"
 #include "BlueprintAssistFormatters/EdGraphParameterFormatter.h"
 #include "BlueprintAssistFormatters/GraphFormatterTypes.h"
@@ -19,16 +20,17 @@
 #include "EdGraph/EdGraphNode.h"
 #include "Editor/BlueprintGraph/Classes/K2Node_Knot.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/ScopeExit.h"
 #include "Stats/StatsMisc.h"
 
-FNodeChangeInfo::FNodeChangeInfo(UEdGraphNode* InNode, UEdGraphNode* InNodeToKeepStill, FCommentHandler* CommentHandler)
+FNodeChangeInfo::FNodeChangeInfo(UEdGraphNode* InNode, UEdGraphNode* InNodeToKeepStill)
 	: Node(InNode)
 	, NodeSizeChangeData(InNode)
 {
-	UpdateValues(InNodeToKeepStill, CommentHandler);
+	UpdateValues(InNodeToKeepStill);
 }
 
-void FNodeChangeInfo::UpdateValues(UEdGraphNode* NodeToKeepStill, FCommentHandler* CommentHandler)
+void FNodeChangeInfo::UpdateValues(UEdGraphNode* NodeToKeepStill)
 {
 	if (!Node.IsValid())
 	{
@@ -41,73 +43,18 @@ void FNodeChangeInfo::UpdateValues(UEdGraphNode* NodeToKeepStill, FCommentHandle
 	NodeOffsetX = Node->NodePosX - NodeToKeepStill->NodePosX;
 	NodeOffsetY = Node->NodePosY - NodeToKeepStill->NodePosY;
 
-	ContainingComments.Empty();
-	for (UEdGraphNode_Comment* Comment : CommentHandler->ContainsGraph->GetContainingCommentsForNode(Node.Get()))
-	{
-		ContainingComments.Add(Comment->NodeGuid);
-	}
-
-	Links.Empty();
-	for (UEdGraphPin* Pin : Node->Pins)
-	{
-		for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-		{
-			Links.Add(FPinLink(Pin, LinkedPin));
-		}
-	}
-
 	NodeSizeChangeData.UpdateNode(Node.Get());
 }
 
-bool FNodeChangeInfo::HasChanged(UEdGraphNode* NodeToKeepStill, FCommentHandler* CommentHandler)
+bool FNodeChangeInfo::HasChanged()
 {
-	// check pin links
-	TSet<FPinLink> NewLinks;
-	for (UEdGraphPin* Pin : Node->Pins)
-	{
-		for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-		{
-			NewLinks.Add(FPinLink(Pin, LinkedPin));
-		}
-	}
-
-	if (NewLinks.Num() != Links.Num())
-	{
-		//UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Num links changed"));
-		return true;
-	}
-
-	for (const FPinLink& Link : Links)
-	{
-		if (!NewLinks.Contains(Link))
-		{
-			//UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("New links does not contain %s"), *Link.ToString());
-			return true;
-		}
-	}
-
 	if (!Node.IsValid())
 	{
 		return false;
 	}
 
-	if (NodeSizeChangeData.HasNodeChanged(Node.Get()))
-	{
-		return true;
-	}
-
-	TSet<FGuid> NewContainingComments;
-	for (UEdGraphNode_Comment* Comment : CommentHandler->ContainsGraph->GetContainingCommentsForNode(Node.Get()))
-	{
-		NewContainingComments.Add(Comment->NodeGuid);
-	}
-
-	if (NewContainingComments.Difference(ContainingComments).Num())
-	{
-		return true;
-	}
-
-	return false;
+	// links and comment containment are covered by the tree fingerprint, this catches nodes whose size is still pending a refresh
+	return NodeSizeChangeData.HasNodeChanged(Node.Get());
 }
 
 FString ChildBranch::ToString() const
@@ -152,8 +99,6 @@ void FEdGraphFormatter::FormatNode(UEdGraphNode* InitialNode)
 
 	TArray<UEdGraphNode*> NewNodeTree = GetNodeTree(InitialNode);
 
-	NodeTree = NewNodeTree;
-
 	const auto& SelectedNodes = GraphHandler->GetSelectedNodes();
 	const bool bAreAllNodesSelected = !NewNodeTree.ContainsByPredicate([&SelectedNodes](UEdGraphNode* Node)
 	{
@@ -163,16 +108,19 @@ void FEdGraphFormatter::FormatNode(UEdGraphNode* InitialNode)
 	GraphHandler->GetFocusedEdGraph()->Modify();
 
 	// check if we can do simple relative formatting
-	if (UBASettings::Get().bEnableFasterFormatting && !IsFormattingRequired(NewNodeTree))
+	if (bCanReplayLayout && !IsFormattingRequired(NewNodeTree))
 	{
 		SimpleRelativeFormatting();
 		// UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Performing simple relative formatting"));
 		return;
 	}
 
+	NodeTree = NewNodeTree;
+
 	KnotTrackCreator.Reset();
 	CommentHandler.Reset();
 	NodeChangeInfos.Reset();
+	TreeFingerprint.Reset();
 	NodePool.Reset();
 	MainParameterFormatter.Reset();
 	ParameterFormatterMap.Reset();
@@ -195,6 +143,12 @@ void FEdGraphFormatter::FormatNode(UEdGraphNode* InitialNode)
 
 	RemoveKnotNodes();
 
+	// removed knots are pooled for the knot tracks, the ones left over are deleted however this pass ends
+	ON_SCOPE_EXIT
+	{
+		KnotTrackCreator.ReleaseKnotNodePool();
+	};
+
 	BA_DEBUG_EARLY_EXIT("RemoveKnotNodes");
 
 	NodeToKeepStill = FormatterParameters.NodeToKeepStill.IsValid() ? FormatterParameters.NodeToKeepStill.Get() : RootNode;
@@ -210,6 +164,7 @@ void FEdGraphFormatter::FormatNode(UEdGraphNode* InitialNode)
 		MainParameterFormatter = MakeShared<FEdGraphParameterFormatter>(GraphHandler, RootNode, SharedThis(this), NodeToKeepStill);
 		MainParameterFormatter->FormatNode(RootNode);
 		CommentHandler.BuildTree();
+		GraphHandler->FlushNodeMoves();
 		KnotTrackCreator.FormatKnotNodes();
 		return;
 	}
@@ -220,6 +175,9 @@ void FEdGraphFormatter::FormatNode(UEdGraphNode* InitialNode)
 
 	const FVector2D SavedLocation = FVector2D(NodeToKeepStill->NodePosX, NodeToKeepStill->NodePosY);
 
+	// links stay the same until the knot nodes are created
+	Adjacency.Build(RootNode);
+
 	// initialize the node pool from the root node
 	InitNodePool();
 	ConnectionValidator.CreateSnapshot(NodePool);
@@ -322,6 +280,11 @@ void FEdGraphFormatter::FormatNode(UEdGraphNode* InitialNode)
 	// TODO: Finish logic for wrapping nodes
 	// WrapNodes();
 
+	Adjacency.Reset();
+
+	// creating knots saves the linked nodes for undo, so the moved nodes must be saved at their original position first
+	GraphHandler->FlushNodeMoves();
+
 	/** Format knot nodes */
 	if (UBASettings::Get().bCreateKnotNodes)
 	{
@@ -405,7 +368,7 @@ void FEdGraphFormatter::InitNodePool()
 	UEdGraphNode* RootNode = GetRootNode();
 
 	OutputNodeStack.Push(RootNode);
-	RootNode->Modify();
+	GraphHandler->ModifyNodeForMove(RootNode);
 
 	while (InputNodeStack.Num() > 0 || OutputNodeStack.Num() > 0)
 	{
@@ -448,7 +411,7 @@ void FEdGraphFormatter::InitNodePool()
 						continue;
 					}
 
-					LinkedNode->Modify();
+					GraphHandler->ModifyNodeForMove(LinkedNode);
 
 					FBAUtils::StraightenPin(GraphHandler, Pin, LinkedPin);
 
@@ -994,7 +957,7 @@ TArray<FPinLink> FEdGraphFormatter::GetNodesToExpand()
 				{
 					if (UBASettings::Get().FormattingStyle == EBANodeFormattingStyle::Expanded)
 					{
-						const bool bHasCycle = PendingNodes.Contains(LinkedNode) || FBAUtils::GetExecTree(LinkedNode, EGPD_Input).Contains(CurrentInfo.GetNode());
+						const bool bHasCycle = PendingNodes.Contains(LinkedNode) || Adjacency.IsInTree(LinkedNode, CurrentInfo.GetNode(), EBALinkKindMask::Exec, EGPD_Input);
 						if (!bHasCycle)
 						{
 							if (CurrentInfo.GetDirection() == EGPD_Output)
@@ -1080,6 +1043,7 @@ void FEdGraphFormatter::ExpandByHeight()
 void FEdGraphFormatter::ExpandNodesAheadOfParameters()
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FEdGraphFormatter::ExpandNodesAheadOfParameters"), STAT_EdGraphFormatter_ExpandNodesAheadOfParameters, STATGROUP_BA_EdGraphFormatter);
+	TArray<UEdGraphNode*> ParameterNodes;
 	for (UEdGraphNode* Node : NodePool)
 	{
 		if (!ensure(FormatXInfoMap.Contains(Node)))
@@ -1094,7 +1058,8 @@ void FEdGraphFormatter::ExpandNodesAheadOfParameters()
 		const TArray<FPinLink> PinLinks = Info->GetChildrenAsLinks(EGPD_Output);
 
 		int32 LargestExpandX = 0;
-		TArray<UEdGraphNode*> ParameterNodes = FBAUtils::GetLinkedNodes(Node, EGPD_Input).FilterByPredicate(FBAUtils::IsNodePure);
+		Adjacency.GetLinkedNodes(Node, ParameterNodes, EBALinkKindMask::All, EGPD_Input);
+		ParameterNodes.RemoveAllSwap([](UEdGraphNode* Param) { return !FBAUtils::IsNodePure(Param); });
 
 		// UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Check %s %d"), *FBAUtils::GetNodeName(Node), LargestExpandX);
 		for (UEdGraphNode* Param : ParameterNodes)
@@ -2840,7 +2805,7 @@ void FEdGraphFormatter::GetPinsOfSameHeight()
 void FEdGraphFormatter::FormatParameterNodes()
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FEdGraphFormatter::FormatParameterNodes"), STAT_EdGraphFormatter_FormatParameterNodes, STATGROUP_BA_EdGraphFormatter);
-	TArray<UEdGraphNode*> IgnoredNodes = GetFormatterParameters().IgnoredNodes.GetCachedNodes();
+	TSet<UEdGraphNode*> IgnoredNodes(GetFormatterParameters().IgnoredNodes.GetCachedNodes());
 
 	TArray<UEdGraphNode*> NodePoolCopy = NodePool;
 
@@ -2884,7 +2849,7 @@ void FEdGraphFormatter::FormatParameterNodes()
 		}
 
 		// the next main nodes will ignore the input nodes from the parameter formatter
-		IgnoredNodes.Append(ParameterFormatter->FormattedInputNodes.Array());
+		IgnoredNodes.Append(ParameterFormatter->FormattedInputNodes);
 	}
 
 	// Format once again with proper ignored nodes
@@ -2947,6 +2912,14 @@ void FEdGraphFormatter::RefreshParameters(UEdGraphNode* Node)
 
 bool FEdGraphFormatter::IsFormattingRequired(const TArray<UEdGraphNode*>& NewNodeTree)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FEdGraphFormatter::IsFormattingRequired"), STAT_EdGraphFormatter_IsFormattingRequired, STATGROUP_BA_EdGraphFormatter);
+
+	// the stored layout was made without the override style
+	if (!TreeFingerprint.IsSet() || FormatterParameters.OverrideFormattingStyle.IsValid())
+	{
+		return true;
+	}
+
 	if (!NewNodeTree.Contains(NodeToKeepStill))
 	{
 		return true;
@@ -2959,39 +2932,74 @@ bool FEdGraphFormatter::IsFormattingRequired(const TArray<UEdGraphNode*>& NewNod
 		return true;
 	}
 
-	// Check if the number of nodes has changed
-	if (NodeTree.Num() != NewNodeTree.Num())
+	// Check if the node set, links, cached sizes or containing comments have changed
+	if (GetTreeFingerprint(NewNodeTree, FormatterParameters.MasterContainsGraph) != TreeFingerprint.GetValue())
 	{
-		//UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Num nodes changed %d to %d"), NewNodeTree.Num(), NodeTree.Num());
+		//UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Node tree fingerprint changed"));
 		return true;
 	}
 
-	// Check if the node tree has changed
-	for (UEdGraphNode* Node : NewNodeTree)
+	for (UEdGraphNode* Node : GetFormattedNodes())
 	{
-		if (!NodeTree.Contains(Node))
+		FNodeChangeInfo* ChangeInfo = NodeChangeInfos.Find(Node);
+		if (ChangeInfo && ChangeInfo->HasChanged())
 		{
-			//UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Node tree changed for node %s"), *FBAUtils::GetNodeName(Node));
 			return true;
 		}
 	}
 
-	// Check if any formatted nodes from last time have changed position or links
-	for (UEdGraphNode* Node : GetFormattedNodes())
+	return false;
+}
+
+FNodeTreeFingerprint FEdGraphFormatter::GetTreeFingerprint(const TArray<UEdGraphNode*>& InNodeTree, TSharedPtr<FBACommentContainsGraph> ContainsGraph) const
+{
+	// nodes, links and comments are summed so the order they are gathered in doesn't matter
+	uint32 NodesHash = 0;
+	for (UEdGraphNode* Node : InNodeTree)
 	{
-		// Check if node has changed
-		if (NodeChangeInfos.Contains(Node))
+		uint32 NodeHash = GetTypeHash(Node->NodeGuid);
+
+		const FBANodeData& NodeData = GraphHandler->GetNodeData(Node);
+		if (NodeData.HasSize())
+		{
+			NodeHash = HashCombine(NodeHash, GetTypeHash(NodeData.GetNodeSize()));
+		}
+
+		uint32 LinksHash = 0;
+		for (UEdGraphPin* Pin : Node->Pins)
 		{
-			FNodeChangeInfo ChangeInfo = NodeChangeInfos[Node];
-			if (ChangeInfo.HasChanged(NodeToKeepStill, &CommentHandler))
+			if (Pin->bHidden)
 			{
-				//UE_LOG(LogBlueprintAssist, VeryVerbose, TEXT("Node links or position has changed"));
-				return true;
+				LinksHash += GetTypeHash(Pin->PinId);
+			}
+
+			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				LinksHash += HashCombine(GetTypeHash(Pin->PinId), GetTypeHash(LinkedPin->PinId));
+			}
+		}
+
+		NodeHash = HashCombine(NodeHash, LinksHash);
+
+		if (ContainsGraph.IsValid())
+		{
+			uint32 CommentsHash = 0;
+			for (UEdGraphNode_Comment* Comment : ContainsGraph->GetContainingCommentsForNode(Node))
+			{
+				CommentsHash += GetTypeHash(Comment->NodeGuid);
 			}
+
+			NodeHash = HashCombine(NodeHash, CommentsHash);
 		}
+
+		NodesHash += NodeHash;
 	}
 
-	return false;
+	FNodeTreeFingerprint Fingerprint;
+	Fingerprint.RootNodeGuid = RootNodeWeakPtr.IsValid() ? RootNodeWeakPtr->NodeGuid : FGuid();
+	Fingerprint.NumNodes = InNodeTree.Num();
+	Fingerprint.Hash = NodesHash;
+	return Fingerprint;
 }
 
 void FEdGraphFormatter::SaveFormattingEndInfo()
@@ -3005,13 +3013,29 @@ void FEdGraphFormatter::SaveFormattingEndInfo()
 	{
 		if (NodeChangeInfos.Contains(Node))
 		{
-			NodeChangeInfos[Node].UpdateValues(NodeToKeepStill, &CommentHandler);
+			NodeChangeInfos[Node].UpdateValues(NodeToKeepStill);
 		}
 		else
 		{
-			NodeChangeInfos.Add(Node, FNodeChangeInfo(Node, NodeToKeepStill, &CommentHandler));
+			NodeChangeInfos.Add(Node, FNodeChangeInfo(Node, NodeToKeepStill));
 		}
 	}
+
+	// only formatters kept by the graph handler replay their layout, skip building the contains graph for the others
+	if (!bCanReplayLayout || FormatterParameters.OverrideFormattingStyle.IsValid())
+	{
+		TreeFingerprint.Reset();
+		return;
+	}
+
+	// the master contains graph was built before formatting, so it misses knots created by this pass and the nodes
+	// that now count as being inside comments. Rebuild it from the final graph, the same way the next pass will
+	TSharedPtr<FBACommentContainsGraph> FinalContainsGraph = MakeShared<FBACommentContainsGraph>();
+	FinalContainsGraph->Init(GraphHandler);
+	FinalContainsGraph->BuildCommentTree();
+
+	// the tree includes the knot nodes created by this pass, which is what the next pass will gather
+	TreeFingerprint = GetTreeFingerprint(GetNodeTree(GetRootNode()), FinalContainsGraph);
 }
 
 TArray<UEdGraphNode*> FEdGraphFormatter::GetNodeTree(UEdGraphNode* InitialNode) const
@@ -3254,20 +3278,24 @@ bool FEdGraphFormatter::ShouldIgnoreComment(TSharedPtr<FBACommentContainsNode> C
 		return NodesUnderComment.Contains(PinLink.GetNode());
 	};
 
-	const TSet<UEdGraphNode*> CommentNodeTree = FBAUtils::GetNodeTreeWithFilter(AllNodesUnderComment[0], IsUnderComment);
-	if (CommentNodeTree.Num() != NodesUnderComment.Num())
+	TArray<UEdGraphNode*> CommentNodeTree;
+	if (Adjacency.GetNodeId(AllNodesUnderComment[0]) != INDEX_NONE)
 	{
-		// UE_LOG(LogTemp, Error, TEXT("IGNORE Same node tree"));
-		return true;
+		Adjacency.GetNodeTreeWithFilter(AllNodesUnderComment[0], CommentNodeTree, [this, &NodesUnderComment](const FBAAdjacencyLink& Link)
+		{
+			return NodesUnderComment.Contains(Adjacency.GetNode(Link.ToNodeId));
+		});
+	}
+	else
+	{
+		CommentNodeTree = FBAUtils::GetNodeTreeWithFilter(AllNodesUnderComment[0], IsUnderComment).Array();
 	}
 
-	for (UEdGraphNode* Node : NodesUnderComment)
+	// the tree only walks into nodes under the comment, so it holds all of them when the counts match
+	if (CommentNodeTree.Num() != NodesUnderComment.Num())
 	{
-		if (!CommentNodeTree.Contains(Node))
-		{
-			// UE_LOG(LogTemp, Error, TEXT("IGNORE Comment node tree"));
-			return true;
-		}
+		// UE_LOG(LogTemp, Error, TEXT("IGNORE Same node tree"));
+		return true;
 	}
 
 	// UE_LOG(LogTemp, Error, TEXT("\tDONT IGNOREComment node tree"));
@@ -6,13 +6,17 @@
 #include "BlueprintAssistGraphHandler.h"
 #include "BlueprintAssistSettings.h"
 #include "BlueprintAssistStats.h"
+#include "BlueprintAssistTabHandler.h"
 #include "BlueprintAssistUtils.h"
 #include "EdGraphNode_Comment.h"
+#include "BlueprintAssistFormatters/BAFormatGeometry.h"
 #include "BlueprintAssistFormatters/EdGraphFormatter.h"
 #include "BlueprintAssistFormatters/GraphFormatterTypes.h"
 #include "BlueprintAssistWidgets/BlueprintAssistGraphOverlay.h"
 #include "Containers/Queue.h"
+#include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
+#include "HAL/IConsoleManager.h"
 
 FEdGraphParameterFormatter::FEdGraphParameterFormatter(
 	TSharedPtr<FBAGraphHandler> InGraphHandler,
@@ -191,6 +195,37 @@ void FEdGraphParameterFormatter::FormatNode(UEdGraphNode* InNode)
 	// }
 }
 
+void FEdGraphParameterFormatter::GetLinkedPureInputNodes(UEdGraphNode* Node, TSet<UEdGraphNode*>& OutNodes) const
+{
+	const auto AddLinkedPin = [this, &OutNodes](UEdGraphPin* LinkedPin)
+	{
+		UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
+		if (FBAUtils::IsParameterPin(LinkedPin) && !IgnoredNodes.Contains(LinkedNode) && FBAUtils::IsNodePure(LinkedNode))
+		{
+			OutNodes.Add(LinkedNode);
+		}
+	};
+
+	// every parameter formatter of the root tree walks the same pure nodes, reuse the links gathered once by the graph formatter
+	const FBAGraphAdjacency& Adjacency = GraphFormatter->GetAdjacency();
+	const int32 NodeId = Adjacency.GetNodeId(Node);
+	if (NodeId != INDEX_NONE)
+	{
+		// exec links never end on a parameter pin, delegate links still go through IsParameterPin
+		Adjacency.ForEachLink(NodeId, EGPD_Input, EBALinkKindMask::Parameter | EBALinkKindMask::Delegate, [&AddLinkedPin](const FBAAdjacencyLink& Link)
+		{
+			AddLinkedPin(Link.To);
+		});
+
+		return;
+	}
+
+	for (UEdGraphPin* LinkedPin : FBAUtils::GetLinkedToPins(Node, EGPD_Input))
+	{
+		AddLinkedPin(LinkedPin);
+	}
+}
+
 bool FEdGraphParameterFormatter::DoesHelixingApply()
 {
 	EBAParameterFormattingStyle FormattingStyleToUse = UBASettings::Get().ParameterStyle;
@@ -209,29 +244,15 @@ bool FEdGraphParameterFormatter::DoesHelixingApply()
 	TArray<UEdGraphNode*> NodeQueue;
 	NodeQueue.Add(RootNode);
 
-	const auto& IgnoredNodesCopy = IgnoredNodes;
-
 	TSet<UEdGraphNode*> GatheredInputNodes;
+	TSet<UEdGraphNode*> LinkedToNodesInput;
 
 	while (NodeQueue.Num() > 0)
 	{
 		UEdGraphNode* NextNode = NodeQueue.Pop();
 
-		const auto Pred = [&IgnoredNodesCopy](UEdGraphPin* Pin)
-		{
-			return FBAUtils::IsParameterPin(Pin) && !IgnoredNodesCopy.Contains(Pin->GetOwningNode());
-		};
-
-		TArray<UEdGraphPin*> LinkedToPinsInput = FBAUtils::GetLinkedToPins(NextNode, EGPD_Input).FilterByPredicate(Pred);
-
-		TSet<UEdGraphNode*> LinkedToNodesInput;
-		for (UEdGraphPin* Pin : LinkedToPinsInput)
-		{
-			if (FBAUtils::IsNodePure(Pin->GetOwningNode()))
-			{
-				LinkedToNodesInput.Add(Pin->GetOwningNode());
-			}
-		}
+		LinkedToNodesInput.Reset();
+		GetLinkedPureInputNodes(NextNode, LinkedToNodesInput);
 
 		if (UBASettings::Get().bDisableHelixingWithMultiplePins)
 		{
@@ -300,90 +321,117 @@ void FEdGraphParameterFormatter::ProcessSameRowMapping(UEdGraphNode* CurrentNode
 		return;
 	}
 
-	auto LinkedToSorter = [&](UEdGraphPin& PinA, UEdGraphPin& PinB)
+	struct FLocal
 	{
-		struct FLocal
+		static void GetPins(UEdGraphPin* NextPin, TSet<UEdGraphNode*>& VisitedNodes, TArray<UEdGraphPin*>& OutPins, bool& bHasEventNode, int32& DepthToEventNode, int32 TempDepth)
 		{
-			static void GetPins(UEdGraphPin* NextPin, TSet<UEdGraphNode*>& VisitedNodes, TArray<UEdGraphPin*>& OutPins, bool& bHasEventNode, int32& DepthToEventNode, int32 TempDepth)
+			if (FBAUtils::IsEventNode(NextPin->GetOwningNode()))
 			{
-				if (FBAUtils::IsEventNode(NextPin->GetOwningNode()))
-				{
-					DepthToEventNode = TempDepth;
-					bHasEventNode = true;
-				}
+				DepthToEventNode = TempDepth;
+				bHasEventNode = true;
+			}
 
-				if (VisitedNodes.Contains(NextPin->GetOwningNode()))
-				{
-					OutPins.Add(NextPin);
-					return;
-				}
+			if (VisitedNodes.Contains(NextPin->GetOwningNode()))
+			{
+				OutPins.Add(NextPin);
+				return;
+			}
 
-				VisitedNodes.Add(NextPin->GetOwningNode());
+			VisitedNodes.Add(NextPin->GetOwningNode());
 
-				auto NextPins = FBAUtils::GetLinkedToPins(NextPin->GetOwningNode(), EGPD_Input);
+			auto NextPins = FBAUtils::GetLinkedToPins(NextPin->GetOwningNode(), EGPD_Input);
 
-				for (UEdGraphPin* Pin : NextPins)
-				{
-					GetPins(Pin, VisitedNodes, OutPins, bHasEventNode, DepthToEventNode, TempDepth + 1);
-				}
+			for (UEdGraphPin* Pin : NextPins)
+			{
+				GetPins(Pin, VisitedNodes, OutPins, bHasEventNode, DepthToEventNode, TempDepth + 1);
 			}
+		}
 
-			static UEdGraphPin* HighestPin(TSharedPtr<FBAGraphHandler> GraphHandler, UEdGraphPin* Pin, TSet<UEdGraphNode*>& VisitedNodes, bool& bHasEventNode, int32& DepthToEventNode)
+		static UEdGraphPin* HighestPin(TSharedPtr<FBAGraphHandler> GraphHandler, UEdGraphPin* Pin, TSet<UEdGraphNode*>& VisitedNodes, bool& bHasEventNode, int32& DepthToEventNode)
+		{
+			TArray<UEdGraphPin*> OutPins;
+			GetPins(Pin, VisitedNodes, OutPins, bHasEventNode, DepthToEventNode, 0);
+
+			if (OutPins.Num() == 0)
 			{
-				TArray<UEdGraphPin*> OutPins;
-				GetPins(Pin, VisitedNodes, OutPins, bHasEventNode, DepthToEventNode, 0);
+				return nullptr;
+			}
 
-				if (OutPins.Num() == 0)
+			OutPins.StableSort([GraphHandler](UEdGraphPin& PinA, UEdGraphPin& PinB)
+			{
+				const FVector2D PinPosA = FBAUtils::GetPinPos(GraphHandler, &PinA);
+				const FVector2D PinPosB = FBAUtils::GetPinPos(GraphHandler, &PinB);
+
+				if (PinPosA.X != PinPosB.X)
 				{
-					return nullptr;
+					return PinPosA.X < PinPosB.X;
 				}
 
-				OutPins.StableSort([GraphHandler](UEdGraphPin& PinA, UEdGraphPin& PinB)
-				{
-					const FVector2D PinPosA = FBAUtils::GetPinPos(GraphHandler, &PinA);
-					const FVector2D PinPosB = FBAUtils::GetPinPos(GraphHandler, &PinB);
+				return PinPosA.Y < PinPosB.Y;
+			});
 
-					if (PinPosA.X != PinPosB.X)
-					{
-						return PinPosA.X < PinPosB.X;
-					}
+			return OutPins[0];
+		}
+	};
 
-					return PinPosA.Y < PinPosB.Y;
-				});
+	struct FLinkedToSortKey
+	{
+		UEdGraphPin* Pin = nullptr;
+		UEdGraphPin* HighestPin = nullptr;
+		FVector2D HighestPinPos = FVector2D::ZeroVector;
+		bool bHasEventNode = false;
+		int32 DepthToEventNode = 0;
+	};
 
-				return OutPins[0];
-			}
-		};
+	// the upstream walk of a pin only depends on the visited nodes, which don't change while sorting,
+	// so walk once per pin instead of twice per comparison
+	const auto SortLinkedTo = [&](TArray<UEdGraphPin*>& LinkedTo)
+	{
+		if (LinkedTo.Num() < 2)
+		{
+			return;
+		}
 
-		bool bHasEventNodeA = false;
-		int32 DepthToEventNodeA = 0;
+		TArray<FLinkedToSortKey, TInlineAllocator<8>> SortKeys;
+		SortKeys.Reserve(LinkedTo.Num());
 
-		auto VisitedNodesCopyA = VisitedNodes;
-		UEdGraphPin* HighestPinA = FLocal::HighestPin(GraphHandler, &PinA, VisitedNodesCopyA, bHasEventNodeA, DepthToEventNodeA);
-		bool bHasEventNodeB = false;
-		int32 DepthToEventNodeB = 0;
-		auto VisitedNodesCopyB = VisitedNodes;
-		UEdGraphPin* HighestPinB = FLocal::HighestPin(GraphHandler, &PinB, VisitedNodesCopyB, bHasEventNodeB, DepthToEventNodeB);
+		for (UEdGraphPin* Pin : LinkedTo)
+		{
+			FLinkedToSortKey& Key = SortKeys.AddDefaulted_GetRef();
+			Key.Pin = Pin;
 
-		if (HighestPinA == nullptr || HighestPinB == nullptr)
+			TSet<UEdGraphNode*> VisitedNodesCopy = VisitedNodes;
+			Key.HighestPin = FLocal::HighestPin(GraphHandler, Pin, VisitedNodesCopy, Key.bHasEventNode, Key.DepthToEventNode);
+			if (Key.HighestPin)
+			{
+				Key.HighestPinPos = FBAUtils::GetPinPos(GraphHandler, Key.HighestPin);
+			}
+		}
+
+		SortKeys.StableSort([](const FLinkedToSortKey& KeyA, const FLinkedToSortKey& KeyB)
 		{
-			if (bHasEventNodeA != bHasEventNodeB)
+			if (KeyA.HighestPin == nullptr || KeyB.HighestPin == nullptr)
 			{
-				return bHasEventNodeA > bHasEventNodeB;
+				if (KeyA.bHasEventNode != KeyB.bHasEventNode)
+				{
+					return KeyA.bHasEventNode > KeyB.bHasEventNode;
+				}
+
+				return KeyA.DepthToEventNode > KeyB.DepthToEventNode;
 			}
 
-			return DepthToEventNodeA > DepthToEventNodeB;
-		}
+			if (KeyA.HighestPinPos.X != KeyB.HighestPinPos.X)
+			{
+				return KeyA.HighestPinPos.X > KeyB.HighestPinPos.X;
+			}
 
-		const FVector2D PinPosA = FBAUtils::GetPinPos(GraphHandler, HighestPinA);
-		const FVector2D PinPosB = FBAUtils::GetPinPos(GraphHandler, HighestPinB);
+			return KeyA.HighestPinPos.Y < KeyB.HighestPinPos.Y;
+		});
 
-		if (PinPosA.X != PinPosB.X)
+		for (int32 Index = 0; Index < SortKeys.Num(); ++Index)
 		{
-			return PinPosA.X > PinPosB.X;
+			LinkedTo[Index] = SortKeys[Index].Pin;
 		}
-
-		return PinPosA.Y < PinPosB.Y;
 	};
 
 	VisitedNodes.Add(CurrentNode);
@@ -400,7 +448,7 @@ void FEdGraphParameterFormatter::ProcessSameRowMapping(UEdGraphNode* CurrentNode
 			}
 
 			TArray<UEdGraphPin*> LinkedTo = MyPin->LinkedTo;
-			LinkedTo.StableSort(LinkedToSorter);
+			SortLinkedTo(LinkedTo);
 
 			for (UEdGraphPin* OtherPin : LinkedTo)
 			{
@@ -588,7 +636,7 @@ void FEdGraphParameterFormatter::FormatX()
 			}
 			else
 			{
-				CurrentNode->Modify();
+				GraphHandler->ModifyNodeForMove(CurrentNode);
 
 				if (CurrentNode != RootNode)
 				{
@@ -1106,6 +1154,8 @@ void FEdGraphParameterFormatter::ExpandByHeight()
 	TSet<UEdGraphNode*> NodesToExpand = FormattedInputNodes;
 	NodesToExpand.Add(RootNode);
 
+	const FBAGraphAdjacency& Adjacency = GraphFormatter->GetAdjacency();
+
 	for (UEdGraphNode* FormattedNode : NodesToExpand)
 	{
 		for (EEdGraphPinDirection Direction : InputOutput)
@@ -1129,7 +1179,19 @@ void FEdGraphParameterFormatter::ExpandByHeight()
 			const int32 ExpandDirection = Direction == EGPD_Input ? -1 : 1;
 			const float ExpandX = ExpandDirection * LargestPinDelta * 0.2f;
 
-			const auto NodeTree = FBAUtils::GetNodeTreeWithFilter(FormattedNode, IsFormatted, Direction, true);
+			TArray<UEdGraphNode*> NodeTree;
+			if (Adjacency.GetNodeId(FormattedNode) != INDEX_NONE)
+			{
+				Adjacency.GetNodeTreeWithFilter(FormattedNode, NodeTree, [&IsFormatted](const FBAAdjacencyLink& Link)
+				{
+					return IsFormatted(Link.To);
+				}, Direction, true);
+			}
+			else
+			{
+				NodeTree = FBAUtils::GetNodeTreeWithFilter(FormattedNode, IsFormatted, Direction, true).Array();
+			}
+
 			for (UEdGraphNode* Node : NodeTree)
 			{
 				if (Node != FormattedNode && Node != RootNode)
@@ -1314,20 +1376,26 @@ bool FEdGraphParameterFormatter::ShouldIgnoreComment(TSharedPtr<FBACommentContai
 		return NodesUnderComment.Contains(PinLink.GetNode());
 	};
 
-	const TSet<UEdGraphNode*> CommentNodeTree = FBAUtils::GetNodeTreeWithFilter(AllNodesUnderComment[0], IsUnderComment);
-	if (CommentNodeTree.Num() != NodesUnderComment.Num())
+	const FBAGraphAdjacency& Adjacency = GraphFormatter->GetAdjacency();
+
+	TArray<UEdGraphNode*> CommentNodeTree;
+	if (Adjacency.GetNodeId(AllNodesUnderComment[0]) != INDEX_NONE)
 	{
-		// UE_LOG(LogTemp, Warning, TEXT("\tPARAM Skipping not in node tree %s"), *FBAUtils::GetNodeName(Comment));
-		return true;
+		Adjacency.GetNodeTreeWithFilter(AllNodesUnderComment[0], CommentNodeTree, [&Adjacency, &NodesUnderComment](const FBAAdjacencyLink& Link)
+		{
+			return NodesUnderComment.Contains(Adjacency.GetNode(Link.ToNodeId));
+		});
+	}
+	else
+	{
+		CommentNodeTree = FBAUtils::GetNodeTreeWithFilter(AllNodesUnderComment[0], IsUnderComment).Array();
 	}
 
-	for (UEdGraphNode* Node : NodesUnderComment)
+	// the tree only walks into nodes under the comment, so it holds all of them when the counts match
+	if (CommentNodeTree.Num() != NodesUnderComment.Num())
 	{
-		if (!CommentNodeTree.Contains(Node))
-		{
-			// UE_LOG(LogTemp, Warning, TEXT("\tPARAM Skipping not in node tree 2 %s"), *FBAUtils::GetNodeName(Comment));
-			return true;
-		}
+		// UE_LOG(LogTemp, Warning, TEXT("\tPARAM Skipping not in node tree %s"), *FBAUtils::GetNodeName(Comment));
+		return true;
 	}
 
 	return false;
@@ -1783,4 +1851,97 @@ void FEdGraphParameterFormatter::ApplyCommentPaddingY_Recursive(TArray<UEdGraphN
 FEdGraphFormatterParameters& FEdGraphParameterFormatter::GetFormatterParameters()
 {
 	return GraphFormatter->GetFormatterParameters();
-}
\ No newline at end of file
+}
+
+namespace BAParameterFormatterBenchmark
+{
+	/** Formats the parameters of every impure node in the focused graph, walking the pins directly and through FBAGraphAdjacency */
+	static void Run(const TArray<FString>& Args)
+	{
+		TSharedPtr<FBAGraphHandler> GraphHandler = FBATabHandler::Get().GetActiveGraphHandler();
+		UEdGraph* Graph = GraphHandler.IsValid() ? GraphHandler->GetFocusedEdGraph() : nullptr;
+		if (!Graph || Graph->Nodes.Num() == 0)
+		{
+			UE_LOG(LogBlueprintAssist, Warning, TEXT("BlueprintAssist.BenchmarkParameterFormatting: open a graph first"));
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1;
+
+		TMap<UEdGraphNode*, FIntPoint> SavedPositions;
+		TArray<UEdGraphNode*> RootNodes;
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			SavedPositions.Add(Node, FIntPoint(Node->NodePosX, Node->NodePosY));
+
+			const bool bHasLinkedParameters = FBAUtils::GetLinkedPins(Node, EGPD_Input).ContainsByPredicate(FBAUtils::IsParameterPin);
+			if (FBAUtils::IsNodeImpure(Node) && bHasLinkedParameters)
+			{
+				RootNodes.Add(Node);
+			}
+		}
+
+		const auto RestorePositions = [&SavedPositions]()
+		{
+			for (const TPair<UEdGraphNode*, FIntPoint>& Saved : SavedPositions)
+			{
+				Saved.Key->NodePosX = Saved.Value.X;
+				Saved.Key->NodePosY = Saved.Value.Y;
+			}
+		};
+
+		double PinsTime = 0.0;
+		double AdjacencyBuildTime = 0.0;
+		double AdjacencyTime = 0.0;
+
+		{
+			FBAFormatGeometryScope GeometryScope(GraphHandler);
+			TSharedPtr<FEdGraphFormatter> GraphFormatter = MakeShared<FEdGraphFormatter>(GraphHandler, FEdGraphFormatterParameters());
+
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				for (const bool bUseAdjacency : { false, true })
+				{
+					for (UEdGraphNode* Node : RootNodes)
+					{
+						if (bUseAdjacency)
+						{
+							// the formatter builds the adjacency before formatting parameters so it counts towards the adjacency path
+							const double BuildStartTime = FPlatformTime::Seconds();
+							GraphFormatter->GetAdjacency().Build(Node);
+							AdjacencyBuildTime += FPlatformTime::Seconds() - BuildStartTime;
+						}
+						else
+						{
+							GraphFormatter->GetAdjacency().Reset();
+						}
+
+						FEdGraphParameterFormatter ParameterFormatter(GraphHandler, Node, GraphFormatter);
+
+						const double StartTime = FPlatformTime::Seconds();
+						ParameterFormatter.FormatNode(Node);
+						(bUseAdjacency ? AdjacencyTime : PinsTime) += FPlatformTime::Seconds() - StartTime;
+
+						RestorePositions();
+					}
+				}
+			}
+
+			GraphFormatter->GetAdjacency().Reset();
+		}
+
+		UE_LOG(LogBlueprintAssist, Log, TEXT("BlueprintAssist.BenchmarkParameterFormatting: %d root nodes x %d iterations"), RootNodes.Num(), Iterations);
+		UE_LOG(LogBlueprintAssist, Log, TEXT("\tPin links: %.3f ms"), PinsTime * 1000.0);
+		UE_LOG(LogBlueprintAssist, Log, TEXT("\tFBAGraphAdjacency: %.3f ms (build %.3f ms + format %.3f ms)"), (AdjacencyBuildTime + AdjacencyTime) * 1000.0, AdjacencyBuildTime * 1000.0, AdjacencyTime * 1000.0);
+	}
+
+	static FAutoConsoleCommand CmdBenchmarkParameterFormatting(
+		TEXT("BlueprintAssist.BenchmarkParameterFormatting"),
+		TEXT("Times parameter formatting of every impure node in the focused graph with and without the shared adjacency. Optional arg: number of iterations"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
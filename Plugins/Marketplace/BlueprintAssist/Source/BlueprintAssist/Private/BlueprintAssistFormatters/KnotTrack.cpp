@@ -31,7 +31,7 @@ TArray<UEdGraphPin*> FKnotNodeCreation::GetPinsToConnectTo() const
 	return Pins;
 }
 
-UK2Node_Knot* FKnotNodeCreation::CreateKnotNode(const FVector2D InKnotPos, UEdGraphPin* PreviousPin, UK2Node_Knot* KnotNodeToReuse, UEdGraph* Graph)
+UK2Node_Knot* FKnotNodeCreation::CreateKnotNode(const FVector2D InKnotPos, UEdGraphPin* PreviousPin, UK2Node_Knot* KnotNodeToReuse, UEdGraph* Graph, bool bNotifyGraph)
 {
 	// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Create knot node for pin %s"), *FBAUtils::GetPinName(PreviousPin));
 
@@ -41,7 +41,7 @@ UK2Node_Knot* FKnotNodeCreation::CreateKnotNode(const FVector2D InKnotPos, UEdGr
 
 	if (KnotNodeToReuse == nullptr)
 	{
-		CreatedKnot = FBAUtils::CreateKnotNode(Graph, InKnotPos, MainPinToConnectTo, PreviousPin);
+		CreatedKnot = FBAUtils::CreateKnotNode(Graph, InKnotPos, MainPinToConnectTo, PreviousPin, bNotifyGraph);
 	}
 	else
 	{
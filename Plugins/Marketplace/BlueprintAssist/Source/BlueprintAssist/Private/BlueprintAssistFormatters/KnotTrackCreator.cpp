@@ -2,6 +2,7 @@
 
 #include "BlueprintAssistFormatters/KnotTrackCreator.h"
 
+#include "Algo/BinarySearch.h"
 #include "BlueprintAssistGraphHandler.h"
 #include "BlueprintAssistStats.h"
 #include "BlueprintAssistUtils.h"
@@ -14,6 +15,103 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Stats/StatsMisc.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("FKnotTrackCreator::ExpandKnotTracks overlap tests"), STAT_KnotTrackCreator_OverlapTests, STATGROUP_BA_EdGraphFormatter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FKnotTrackCreator knots reused"), STAT_KnotTrackCreator_KnotsReused, STATGROUP_BA_EdGraphFormatter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FKnotTrackCreator knots created"), STAT_KnotTrackCreator_KnotsCreated, STATGROUP_BA_EdGraphFormatter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FKnotTrackCreator knots deleted"), STAT_KnotTrackCreator_KnotsDeleted, STATGROUP_BA_EdGraphFormatter);
+
+struct FKnotTrackSortKey
+{
+	TSharedPtr<FKnotNodeTrack> Track;
+	bool bIsLoopingTrack;
+	bool bIsLastPinExecOrDelegate;
+	float TrackHeight;
+	float Width;
+	float LastPinY;
+
+	FKnotTrackSortKey(TSharedPtr<FBAGraphHandler> GraphHandler, TSharedPtr<FKnotNodeTrack> InTrack)
+		: Track(InTrack)
+		, bIsLoopingTrack(InTrack->bIsLoopingTrack)
+		, bIsLastPinExecOrDelegate(FBAUtils::IsExecOrDelegatePin(InTrack->GetLastPin()))
+		, TrackHeight(InTrack->GetTrackHeight())
+		, Width(InTrack->GetTrackBounds().GetSize().X)
+		, LastPinY(GraphHandler->GetPinY(InTrack->GetLastPin()))
+	{
+	}
+};
+
+/**
+ * Non-looping tracks sorted by the top of their bounds, all tracks share roughly the same height (the track spacing)
+ * so every track overlapping a query in Y starts within [Query.Top - MaxHeight, Query.Bottom]
+ */
+struct FKnotTrackIntervalIndex
+{
+	struct FEntry
+	{
+		int32 SortedIndex;
+		bool bIsExec;
+		float TrackHeight;
+		FSlateRect Bounds;
+	};
+
+	TArray<FEntry> Entries;
+	float MaxHeight = 0.0f;
+
+	void Build(const TArray<TSharedPtr<FKnotNodeTrack>>& SortedTracks, const TBitArray<>& Placed)
+	{
+		Entries.Reset();
+		MaxHeight = 0.0f;
+
+		for (int i = 0; i < SortedTracks.Num(); ++i)
+		{
+			const TSharedPtr<FKnotNodeTrack>& Track = SortedTracks[i];
+			if (Placed[i] || Track->bIsLoopingTrack)
+			{
+				continue;
+			}
+
+			FEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.SortedIndex = i;
+			Entry.bIsExec = FBAUtils::IsExecPin(Track->GetParentPin());
+			Entry.TrackHeight = Track->GetTrackHeight();
+			Entry.Bounds = Track->GetTrackBounds();
+			MaxHeight = FMath::Max(MaxHeight, Entry.Bounds.Bottom - Entry.Bounds.Top);
+		}
+
+		Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Bounds.Top < B.Bounds.Top; });
+	}
+
+	// the unplaced track with the lowest sorted index (at least MinSortedIndex) overlapping the query
+	const FEntry* FindFirstOverlap(const FSlateRect& Query, bool bIsExec, int32 MinSortedIndex, const TBitArray<>& Placed) const
+	{
+		const float LowestTop = Query.Top - MaxHeight;
+		int32 Index = Algo::LowerBoundBy(Entries, LowestTop, [](const FEntry& Entry) { return Entry.Bounds.Top; });
+
+		const FEntry* Result = nullptr;
+		for (; Index < Entries.Num() && Entries[Index].Bounds.Top <= Query.Bottom; ++Index)
+		{
+			const FEntry& Entry = Entries[Index];
+			if (Entry.bIsExec != bIsExec || Entry.SortedIndex < MinSortedIndex || Placed[Entry.SortedIndex])
+			{
+				continue;
+			}
+
+			if (Result && Result->SortedIndex < Entry.SortedIndex)
+			{
+				continue;
+			}
+
+			INC_DWORD_STAT(STAT_KnotTrackCreator_OverlapTests);
+			if (FSlateRect::DoRectanglesIntersect(Query, Entry.Bounds))
+			{
+				Result = &Entry;
+			}
+		}
+
+		return Result;
+	}
+};
+
 void FKnotTrackCreator::Init(TSharedPtr<FFormatterInterface> InFormatter, TSharedPtr<FBAGraphHandler> InGraphHandler)
 {
 	Formatter = InFormatter;
@@ -316,15 +414,7 @@ void FKnotTrackCreator::CreateKnotTracks()
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(GraphHandler->GetBlueprint());
 
-	// Cleanup knot node pool
-	for (auto KnotNode : KnotNodePool)
-	{
-		if (FBAUtils::GetLinkedNodes(KnotNode).Num() == 0)
-		{
-			FBAUtils::DeleteNode(KnotNode);
-		}
-	}
-	KnotNodePool.Empty();
+	ReleaseKnotNodePool();
 }
 
 void FKnotTrackCreator::ExpandKnotTracks()
@@ -346,73 +436,77 @@ void FKnotTrackCreator::ExpandKnotTracks()
 	// 2. Highest track Y
 	// 3. Smallest track width
 	// 4. Parent pin height
-	TSharedPtr<FBAGraphHandler> GraphHandlerCapture = GraphHandler;
-	const auto& ExpandTrackSorter = [GraphHandlerCapture](const TSharedPtr<FKnotNodeTrack>& TrackA, const TSharedPtr<FKnotNodeTrack>& TrackB)
+	// track geometry is computed once into a sort key rather than inside every comparison
+	const auto& ExpandTrackSorter = [](const FKnotTrackSortKey& KeyA, const FKnotTrackSortKey& KeyB)
 	{
-		if (TrackA->bIsLoopingTrack != TrackB->bIsLoopingTrack)
+		if (KeyA.bIsLoopingTrack != KeyB.bIsLoopingTrack)
 		{
-			return TrackA->bIsLoopingTrack < TrackB->bIsLoopingTrack;
+			return KeyA.bIsLoopingTrack < KeyB.bIsLoopingTrack;
 		}
 
-		// if (bIsExecPinA && TrackA->bIsLoopingTrack != TrackB->bIsLoopingTrack)
-		// {
-		// 	return TrackA->bIsLoopingTrack < TrackB->bIsLoopingTrack;
-		// }
-
-		if (TrackA->GetTrackHeight() != TrackB->GetTrackHeight())
+		if (KeyA.TrackHeight != KeyB.TrackHeight)
 		{
-			return TrackA->bIsLoopingTrack
-				? TrackA->GetTrackHeight() > TrackB->GetTrackHeight()
-				: TrackA->GetTrackHeight() < TrackB->GetTrackHeight();
+			return KeyA.bIsLoopingTrack
+				? KeyA.TrackHeight > KeyB.TrackHeight
+				: KeyA.TrackHeight < KeyB.TrackHeight;
 		}
 
-		const bool bIsExecPinA = FBAUtils::IsExecOrDelegatePin(TrackA->GetLastPin());
-		const bool bIsExecPinB = FBAUtils::IsExecOrDelegatePin(TrackB->GetLastPin());
-		if (bIsExecPinA != bIsExecPinB)
+		if (KeyA.bIsLastPinExecOrDelegate != KeyB.bIsLastPinExecOrDelegate)
 		{
-			return bIsExecPinA < bIsExecPinB;
+			return KeyA.bIsLastPinExecOrDelegate < KeyB.bIsLastPinExecOrDelegate;
 		}
 
-		const float WidthA = TrackA->GetTrackBounds().GetSize().X;
-		const float WidthB = TrackB->GetTrackBounds().GetSize().X;
-		if (WidthA != WidthB)
+		if (KeyA.Width != KeyB.Width)
 		{
-			return TrackA->bIsLoopingTrack
-				? WidthA > WidthB
-				: WidthA < WidthB;
+			return KeyA.bIsLoopingTrack
+				? KeyA.Width > KeyB.Width
+				: KeyA.Width < KeyB.Width;
 		}
 
-		return GraphHandlerCapture->GetPinY(TrackA->GetLastPin()) < GraphHandlerCapture->GetPinY(TrackB->GetLastPin());
+		return KeyA.LastPinY < KeyB.LastPinY;
 	};
 
-	const auto& OverlappingTrackSorter = [GraphHandlerCapture](const TSharedPtr<FKnotNodeTrack>& TrackA, const TSharedPtr<FKnotNodeTrack>& TrackB)
+	const auto& OverlappingTrackSorter = [](const FKnotTrackSortKey& KeyA, const FKnotTrackSortKey& KeyB)
 	{
-		if (TrackA->bIsLoopingTrack != TrackB->bIsLoopingTrack)
+		if (KeyA.bIsLoopingTrack != KeyB.bIsLoopingTrack)
 		{
-			return TrackA->bIsLoopingTrack < TrackB->bIsLoopingTrack;
+			return KeyA.bIsLoopingTrack < KeyB.bIsLoopingTrack;
 		}
 
-		const bool bIsExecPinA = FBAUtils::IsExecOrDelegatePin(TrackA->GetLastPin());
-		const bool bIsExecPinB = FBAUtils::IsExecOrDelegatePin(TrackB->GetLastPin());
-		if (bIsExecPinA != bIsExecPinB)
+		if (KeyA.bIsLastPinExecOrDelegate != KeyB.bIsLastPinExecOrDelegate)
 		{
-			return bIsExecPinA > bIsExecPinB;
+			return KeyA.bIsLastPinExecOrDelegate > KeyB.bIsLastPinExecOrDelegate;
 		}
 
-		const float WidthA = TrackA->GetTrackBounds().GetSize().X;
-		const float WidthB = TrackB->GetTrackBounds().GetSize().X;
-		if (WidthA != WidthB)
+		if (KeyA.Width != KeyB.Width)
 		{
-			return TrackA->bIsLoopingTrack
-				? WidthA > WidthB
-				: WidthA < WidthB;
+			return KeyA.bIsLoopingTrack
+				? KeyA.Width > KeyB.Width
+				: KeyA.Width < KeyB.Width;
 		}
 
-		return GraphHandlerCapture->GetPinY(TrackA->GetLastPin()) < GraphHandlerCapture->GetPinY(TrackB->GetLastPin());
+		return KeyA.LastPinY < KeyB.LastPinY;
+	};
+
+	const auto& SortTracksByKey = [this](TArray<TSharedPtr<FKnotNodeTrack>>& Tracks, const auto& Sorter)
+	{
+		TArray<FKnotTrackSortKey> Keys;
+		Keys.Reserve(Tracks.Num());
+		for (TSharedPtr<FKnotNodeTrack> Track : Tracks)
+		{
+			Keys.Add(FKnotTrackSortKey(GraphHandler, Track));
+		}
+
+		Keys.StableSort(Sorter);
+
+		for (int i = 0; i < Keys.Num(); ++i)
+		{
+			Tracks[i] = Keys[i].Track;
+		}
 	};
 
 	TArray<TSharedPtr<FKnotNodeTrack>> SortedTracks = KnotTracks;
-	SortedTracks.StableSort(ExpandTrackSorter);
+	SortTracksByKey(SortedTracks, ExpandTrackSorter);
 
 	TArray<TSharedPtr<FKnotNodeTrack>> PendingTracks = SortedTracks;
 
@@ -427,10 +521,29 @@ void FKnotTrackCreator::ExpandKnotTracks()
 
 	TSet<TSharedPtr<FGroupedTracks>> PlacedGroups;
 	TSet<TSharedPtr<FKnotNodeTrack>> PlacedTracks;
+	TBitArray<> PlacedSortedIndices(false, SortedTracks.Num());
+
+	TMap<TSharedPtr<FKnotNodeTrack>, int32> SortedIndices;
+	SortedIndices.Reserve(SortedTracks.Num());
+	for (int i = 0; i < SortedTracks.Num(); ++i)
+	{
+		SortedIndices.Add(SortedTracks[i], i);
+	}
+
+	const auto& MarkPlaced = [&PlacedTracks, &PlacedSortedIndices, &SortedIndices](TSharedPtr<FKnotNodeTrack> Track)
+	{
+		PlacedTracks.Add(Track);
+		PlacedSortedIndices[SortedIndices.FindChecked(Track)] = true;
+	};
+
+	// overlap queries for non-looping tracks go through an interval index, which is rebuilt whenever placing a group moved nodes around
+	FKnotTrackIntervalIndex OverlapIndex;
+	bool bOverlapIndexDirty = true;
+
 	while (PendingTracks.Num() > 0)
 	{
 		TSharedPtr<FKnotNodeTrack> CurrentTrack = PendingTracks[0];
-		PlacedTracks.Add(CurrentTrack);
+		MarkPlaced(CurrentTrack);
 
 		// const float TrackY = CurrentTrack->GetTrackHeight();
 
@@ -443,82 +556,120 @@ void FKnotTrackCreator::ExpandKnotTracks()
 		float CurrentLowestTrackHeight = CurrentTrack->GetTrackHeight();
 		FSlateRect OverlappingBounds = CurrentTrack->GetTrackBounds();
 		// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Current Track bounds %s"), *CurrentTrack->GetTrackBounds().ToString());
-		bool bFoundCollision = true;
-		do
+
+		const auto& AddOverlappingTrack = [&](TSharedPtr<FKnotNodeTrack> Track, float TrackHeight, const FSlateRect& TrackBounds)
 		{
-			bFoundCollision = false;
-			for (TSharedPtr<FKnotNodeTrack> Track : SortedTracks)
+			OverlappingTracks.Add(Track);
+			MarkPlaced(Track);
+
+			OverlappingBounds.Top = FMath::Min(TrackHeight, OverlappingBounds.Top);
+			OverlappingBounds.Left = FMath::Min(TrackBounds.Left, OverlappingBounds.Left);
+			OverlappingBounds.Right = FMath::Max(TrackBounds.Right, OverlappingBounds.Right);
+			OverlappingBounds.Bottom = OverlappingBounds.Top + (OverlappingTracks.Num() * TrackSpacing);
+
+			if (CurrentTrack->HasPinToAlignTo())
 			{
-				if (PlacedTracks.Contains(Track))
-				{
-					continue;
-				}
+				// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Removed pin to align to for %s"), *CurrentTrack->ToString());
+				CurrentTrack->PinToAlignTo.SetPin(nullptr);
+			}
 
-				if (OverlappingTracks.Contains(Track))
-				{
-					continue;
-				}
+			if (Track->HasPinToAlignTo())
+			{
+				// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Removed pin to align to for %s"), *Track->ToString());
+				Track->PinToAlignTo.SetPin(nullptr);
+			}
+		};
 
-				if (Track->bIsLoopingTrack != CurrentTrack->bIsLoopingTrack)
-				{
-					continue;
-				}
+		if (!CurrentTrack->bIsLoopingTrack)
+		{
+			if (bOverlapIndexDirty)
+			{
+				OverlapIndex.Build(SortedTracks, PlacedSortedIndices);
+				bOverlapIndexDirty = false;
+			}
 
-				if (FBAUtils::IsExecPin(Track->GetParentPin()) != FBAUtils::IsExecPin(CurrentTrack->GetParentPin()))
+			// same visiting order as scanning the sorted tracks until no more collisions are found:
+			// always take the next overlapping track after the last one added, restarting from the beginning after a full pass
+			const bool bIsCurrentExec = FBAUtils::IsExecPin(CurrentTrack->GetParentPin());
+			int32 Cursor = 0;
+			bool bFoundCollision = false;
+			while (true)
+			{
+				const FKnotTrackIntervalIndex::FEntry* Overlap = OverlapIndex.FindFirstOverlap(OverlappingBounds, bIsCurrentExec, Cursor, PlacedSortedIndices);
+				if (!Overlap)
 				{
+					if (!bFoundCollision)
+					{
+						break;
+					}
+
+					bFoundCollision = false;
+					Cursor = 0;
 					continue;
 				}
 
-				// if looping tracks share the same related nodes then they should count as 'overlapping'
-				if (Track->bIsLoopingTrack) // TODO: maybe we should do this for normal tracks too?
+				AddOverlappingTrack(SortedTracks[Overlap->SortedIndex], Overlap->TrackHeight, Overlap->Bounds);
+				Cursor = Overlap->SortedIndex + 1;
+				bFoundCollision = true;
+			}
+		}
+		else
+		{
+			bool bFoundCollision = true;
+			do
+			{
+				bFoundCollision = false;
+				for (TSharedPtr<FKnotNodeTrack> Track : SortedTracks)
 				{
-					TSet<UEdGraphNode*> OverlappingSet;
-					for (TSharedPtr<FKnotNodeTrack> Overlapping : OverlappingTracks)
+					if (PlacedTracks.Contains(Track))
 					{
-						OverlappingSet.Append(Overlapping->GetRelatedNodes());
+						continue;
 					}
 
-					TSet<UEdGraphNode*> TrackSet(Track->GetRelatedNodes());
+					if (Track->bIsLoopingTrack != CurrentTrack->bIsLoopingTrack)
+					{
+						continue;
+					}
 
-					if (OverlappingSet.Intersect(TrackSet).Num() > 0)
+					if (FBAUtils::IsExecPin(Track->GetParentPin()) != FBAUtils::IsExecPin(CurrentTrack->GetParentPin()))
 					{
-						OverlappingTracks.Add(Track);
-						PlacedTracks.Add(Track);
-						bFoundCollision = true;
 						continue;
 					}
-				}
 
-				FSlateRect TrackBounds = Track->GetTrackBounds();
+					INC_DWORD_STAT(STAT_KnotTrackCreator_OverlapTests);
 
-				// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tOverlapping Bounds %s | %s"), *OverlappingBounds.ToString(), *TrackBounds.ToString());
-				if (FSlateRect::DoRectanglesIntersect(OverlappingBounds, TrackBounds))
-				{
-					OverlappingTracks.Add(Track);
-					PlacedTracks.Add(Track);
-					bFoundCollision = true;
+					// if looping tracks share the same related nodes then they should count as 'overlapping'
+					{
+						TSet<UEdGraphNode*> OverlappingSet;
+						for (TSharedPtr<FKnotNodeTrack> Overlapping : OverlappingTracks)
+						{
+							OverlappingSet.Append(Overlapping->GetRelatedNodes());
+						}
 
-					OverlappingBounds.Top = FMath::Min(Track->GetTrackHeight(), OverlappingBounds.Top);
-					OverlappingBounds.Left = FMath::Min(TrackBounds.Left, OverlappingBounds.Left);
-					OverlappingBounds.Right = FMath::Max(TrackBounds.Right, OverlappingBounds.Right);
-					OverlappingBounds.Bottom = OverlappingBounds.Top + (OverlappingTracks.Num() * TrackSpacing);
+						TSet<UEdGraphNode*> TrackSet(Track->GetRelatedNodes());
 
-					if (CurrentTrack->HasPinToAlignTo())
-					{
-						// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Removed pin to align to for %s"), *CurrentTrack->ToString());
-						CurrentTrack->PinToAlignTo.SetPin(nullptr);
+						if (OverlappingSet.Intersect(TrackSet).Num() > 0)
+						{
+							OverlappingTracks.Add(Track);
+							MarkPlaced(Track);
+							bFoundCollision = true;
+							continue;
+						}
 					}
 
-					if (Track->HasPinToAlignTo())
+					FSlateRect TrackBounds = Track->GetTrackBounds();
+
+					// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tOverlapping Bounds %s | %s"), *OverlappingBounds.ToString(), *TrackBounds.ToString());
+					if (FSlateRect::DoRectanglesIntersect(OverlappingBounds, TrackBounds))
 					{
-						// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Removed pin to align to for %s"), *Track->ToString());
-						Track->PinToAlignTo.SetPin(nullptr);
+						AddOverlappingTrack(Track, Track->GetTrackHeight(), TrackBounds);
+						bFoundCollision = true;
+						// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tTrack %s colliding %s"), *FBAUtils::GetPinName(Track->GetParentPin()), *FBAUtils::GetPinName(CurrentTrack->GetParentPin()));
 					}
-					// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tTrack %s colliding %s"), *FBAUtils::GetPinName(Track->GetParentPin()), *FBAUtils::GetPinName(CurrentTrack->GetParentPin()));
 				}
 			}
+			while (bFoundCollision);
 		}
-		while (bFoundCollision);
 
 		// if (OverlappingTracks.Num() == 1)
 		// {
@@ -557,12 +708,12 @@ void FKnotTrackCreator::ExpandKnotTracks()
 			}
 		}
 
-		ExecTracks.StableSort(OverlappingTrackSorter);
+		SortTracksByKey(ExecTracks, OverlappingTrackSorter);
 
 		for (auto& Group : OverlappingGroupedTracks)
 		{
 			Group.Init();
-			Group.Tracks.StableSort(OverlappingTrackSorter);
+			SortTracksByKey(Group.Tracks, OverlappingTrackSorter);
 		}
 
 		const auto& GroupSorter = [](const FGroupedTracks& GroupA, const FGroupedTracks& GroupB)
@@ -650,6 +801,8 @@ void FKnotTrackCreator::ExpandKnotTracks()
 						Formatter->SetNodeY_KeepingSpacingVisited(Node, Node->NodePosY + LoopingDelta.GetValue(), VisitedNodes);
 					}
 
+					bOverlapIndexDirty = true;
+
 					// FBAUtils::PrintNodeArray(VisitedNodes.Array(), "Looping Moooved");
 				}
 			}
@@ -688,6 +841,8 @@ void FKnotTrackCreator::ExpandKnotTracks()
 					{
 						Formatter->SetNodePos(Node, Node->NodePosX, Node->NodePosY + Delta);
 					}
+
+					bOverlapIndexDirty = true;
 				}
 				else
 				{
@@ -713,11 +868,10 @@ void FKnotTrackCreator::ExpandKnotTracks()
 		// }
 		// UE_LOG(LogKnotTrackCreator, Warning, TEXT("TRACK GROUP END"));
 
-		for (TSharedPtr<FKnotNodeTrack> Track : PlacedTracks)
+		PendingTracks.RemoveAll([&PlacedTracks](const TSharedPtr<FKnotNodeTrack>& Track)
 		{
-			// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tPlaced track %s"), *Track->ToString());
-			PendingTracks.Remove(Track);
-		}
+			return PlacedTracks.Contains(Track);
+		});
 
 		TSet<UEdGraphNode*> TrackNodes = CurrentTrack->GetNodes(GraphHandler->GetFocusedEdGraph());
 
@@ -802,6 +956,7 @@ void FKnotTrackCreator::ExpandKnotTracks()
 						{
 							float DeltaY = ExpandedBounds.Bottom - AlignedTrackBounds.Top;
 							Formatter->SetNodeY_KeepingSpacing(Node, Node->NodePosY + DeltaY);
+							bOverlapIndexDirty = true;
 						}
 					}
 				}
@@ -858,6 +1013,7 @@ void FKnotTrackCreator::ExpandKnotTracks()
 				{
 					float DeltaY = ExpandedBounds.Bottom - CollisionTop.GetValue();
 					Formatter->SetNodeY_KeepingSpacing(Node, Node->NodePosY + DeltaY);
+					bOverlapIndexDirty = true;
 				}
 
 				for (TSharedPtr<FKnotNodeTrack> Track : AllGroup->Tracks)
@@ -982,6 +1138,19 @@ void FKnotTrackCreator::RemoveKnotNodes(const TArray<UEdGraphNode*>& NodeTree)
 		/** Delete all connections for each knot node */
 		if (UK2Node_Knot* KnotNode = Cast<UK2Node_Knot>(Node))
 		{
+			const bool bPoolKnotNode = UBASettings::Get().bUseKnotNodePool && UBASettings::Get().bCreateKnotNodes;
+			if (bPoolKnotNode)
+			{
+				// remember which pins the wire through this knot connected, so an unchanged track gets its own knots back
+				for (UEdGraphPin* KnotPin : { KnotNode->GetInputPin(), KnotNode->GetOutputPin() })
+				{
+					for (UEdGraphPin* EndPin : FBAUtils::GetPinLinkedToIgnoringKnots(KnotPin))
+					{
+						PooledKnotsByPin.FindOrAdd(EndPin).Add(KnotNode);
+					}
+				}
+			}
+
 			FBAUtils::DisconnectKnotNode(KnotNode);
 
 			for (auto Comment : CommentNodes)
@@ -992,14 +1161,14 @@ void FKnotTrackCreator::RemoveKnotNodes(const TArray<UEdGraphNode*>& NodeTree)
 				}
 			}
 
-			if (UBASettings::Get().bUseKnotNodePool &&
-				UBASettings::Get().bCreateKnotNodes) // if we don't create knot nodes, no point reusing them
+			if (bPoolKnotNode) // if we don't create knot nodes, no point reusing them
 			{
 				KnotNodePool.Add(KnotNode);
 			}
 			else
 			{
 				FBAUtils::DeleteNode(KnotNode);
+				INC_DWORD_STAT(STAT_KnotTrackCreator_KnotsDeleted);
 
 				if (FCommentHandler* CH = Formatter->GetCommentHandler())
 				{
@@ -1027,16 +1196,29 @@ UK2Node_Knot* FKnotTrackCreator::CreateKnotNode(FKnotNodeCreation* Creation, con
 	UK2Node_Knot* OptionalNodeToReuse = nullptr;
 	if (UBASettings::Get().bUseKnotNodePool && KnotNodePool.Num() > 0)
 	{
-		OptionalNodeToReuse = KnotNodePool.Pop();
+		OptionalNodeToReuse = TakeKnotNodeFromPool(Creation, Position);
+	}
+
+	if (OptionalNodeToReuse)
+	{
+		INC_DWORD_STAT(STAT_KnotTrackCreator_KnotsReused);
 	}
 	else
 	{
-		// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Failed to find?"));
+		INC_DWORD_STAT(STAT_KnotTrackCreator_KnotsCreated);
 	}
 
+	// while batching, the graph is told about all the new knots at once when the batch ends
+	const bool bDeferNotify = GraphHandler->IsNodeMoveBatchActive();
+
 	UEdGraph* Graph = GraphHandler->GetFocusedEdGraph();
-	if (UK2Node_Knot* CreatedNode = Creation->CreateKnotNode(Position, ParentPin, OptionalNodeToReuse, Graph))
+	if (UK2Node_Knot* CreatedNode = Creation->CreateKnotNode(Position, ParentPin, OptionalNodeToReuse, Graph, !bDeferNotify))
 	{
+		if (bDeferNotify && !OptionalNodeToReuse)
+		{
+			GraphHandler->AddNodeAddedDuringNodeMoveBatch(CreatedNode);
+		}
+
 		if (UEdGraphPin* MainPinToConnectTo = Creation->PinToConnectToHandle.GetPin())
 		{
 			KnotNodeOwners.Add(CreatedNode, MainPinToConnectTo->GetOwningNode());
@@ -1215,8 +1397,67 @@ bool FKnotTrackCreator::NodeCollisionBetweenLocation(FVector2D Start, FVector2D
 	return false;
 }
 
+UK2Node_Knot* FKnotTrackCreator::TakeKnotNodeFromPool(FKnotNodeCreation* Creation, const FVector2D& Position)
+{
+	UEdGraphPin* TrackPins[] = {
+		Creation->OwningKnotTrack.IsValid() ? Creation->OwningKnotTrack->GetParentPin() : nullptr,
+		Creation->PinToConnectToHandle.GetPin()
+	};
+
+	// prefer the closest knot which used to be on a wire to the same pins
+	UK2Node_Knot* BestKnot = nullptr;
+	float BestDistSquared = TNumericLimits<float>::Max();
+	for (UEdGraphPin* TrackPin : TrackPins)
+	{
+		if (const TArray<UK2Node_Knot*>* Candidates = PooledKnotsByPin.Find(TrackPin))
+		{
+			for (UK2Node_Knot* Candidate : *Candidates)
+			{
+				const FVector2D KnotPos = FVector2D(Candidate->NodePosX, Candidate->NodePosY) + FBAUtils::GetKnotNodeSize() * 0.5f;
+				const float DistSquared = FVector2D::DistSquared(KnotPos, Position);
+				if (DistSquared < BestDistSquared && KnotNodePool.Contains(Candidate))
+				{
+					BestKnot = Candidate;
+					BestDistSquared = DistSquared;
+				}
+			}
+		}
+	}
+
+	if (!BestKnot)
+	{
+		// any pooled knot is still cheaper than spawning a new node and widget
+		BestKnot = *KnotNodePool.CreateConstIterator();
+	}
+
+	KnotNodePool.Remove(BestKnot);
+	return BestKnot;
+}
+
+void FKnotTrackCreator::ReleaseKnotNodePool()
+{
+	// only the knots which weren't needed this time get deleted
+	for (UK2Node_Knot* KnotNode : KnotNodePool)
+	{
+		if (FBAUtils::GetLinkedNodes(KnotNode).Num() == 0)
+		{
+			FBAUtils::DeleteNode(KnotNode);
+			INC_DWORD_STAT(STAT_KnotTrackCreator_KnotsDeleted);
+
+			if (FCommentHandler* CH = Formatter.IsValid() ? Formatter->GetCommentHandler() : nullptr)
+			{
+				CH->DeleteNode(KnotNode);
+			}
+		}
+	}
+
+	KnotNodePool.Reset();
+	PooledKnotsByPin.Reset();
+}
+
 void FKnotTrackCreator::Reset()
 {
+	ReleaseKnotNodePool();
 	KnotNodesSet.Reset();
 	KnotTracks.Reset();
 	KnotNodeOwners.Reset();
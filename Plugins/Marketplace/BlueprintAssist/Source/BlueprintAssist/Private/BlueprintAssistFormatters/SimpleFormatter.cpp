@@ -3,6 +3,7 @@
 #include "BlueprintAssistFormatters/SimpleFormatter.h"
 
 #include "BlueprintAssistFormatters/BAFormatterUtils.h"
+#include "BlueprintAssistFormatters/BAGraphAdjacency.h"
 #include "BlueprintAssistUtils.h"
 #include "EdGraphNode_Comment.h"
 #include "BlueprintAssistWidgets/BlueprintAssistGraphOverlay.h"
@@ -265,6 +266,10 @@ void FSimpleFormatter::FormatNode(UEdGraphNode* Node)
 
 void FSimpleFormatter::FormatX()
 {
+	// the cycle check below walks the exec tree for every link, walk a prebuilt adjacency instead of the pins
+	FBAGraphAdjacency Adjacency;
+	Adjacency.Build(RootNode);
+
 	TSet<UEdGraphNode*> VisitedNodes;
 	TSet<UEdGraphNode*> PendingNodes;
 	PendingNodes.Add(RootNode);
@@ -309,7 +314,7 @@ void FSimpleFormatter::FormatX()
 		}
 
 		FormattedNodes.Add(CurrentNode);
-		CurrentNode->Modify();
+		GraphHandler->ModifyNodeForMove(CurrentNode);
 
 		// UE_LOG(LogBlueprintAssist, Warning, TEXT("Processing %s | %s"), *FBAUtils::GetNodeName(CurrentNode), *CurrentInfo->Link.ToString());
 		const int32 NewX = GetChildX(CurrentInfo->Link);
@@ -461,7 +466,7 @@ void FSimpleFormatter::FormatX()
 
 						if (CurrentInfo->Link.GetDirection() == FormatterSettings.FormatterDirection)
 						{
-							const bool bHasCycle = PendingNodes.Contains(LinkedNode) || FBAUtils::GetExecTree(LinkedNode, OppositeDirection).Contains(CurrentInfo->GetNode());
+							const bool bHasCycle = PendingNodes.Contains(LinkedNode) || Adjacency.IsInTree(LinkedNode, CurrentInfo->GetNode(), EBALinkKindMask::Exec, OppositeDirection);
 
 							if (!bHasCycle)
 							{
@@ -20,6 +20,7 @@
 #include "ScopedTransaction.h"
 #include "SGraphPanel.h"
 #include "Algo/Transform.h"
+#include "BlueprintAssistFormatters/BAFormatGeometry.h"
 #include "BlueprintAssistFormatters/BAFormatterUtils.h"
 #include "BlueprintAssistFormatters/BehaviorTreeGraphFormatter.h"
 #include "BlueprintAssistFormatters/EdGraphFormatter.h"
@@ -39,6 +40,10 @@
 #include "Misc/TransactionObjectEvent.h"
 #endif
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Graph Changed Notifications"), STAT_GraphHandler_GraphChangedNotifications, STATGROUP_BA_EdGraphFormatter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Nodes Saved For Undo"), STAT_GraphHandler_NodesSavedForUndo, STATGROUP_BA_EdGraphFormatter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Nodes Skipped For Undo"), STAT_GraphHandler_NodesSkippedForUndo, STATGROUP_BA_EdGraphFormatter);
+
 FBAGraphHandler::FBAGraphHandler(
 	TWeakPtr<SDockTab> InTab,
 	TWeakPtr<SGraphEditor> InGraphEditor)
@@ -847,7 +852,7 @@ void FBAGraphHandler::MoveUnrelatedNodes(TSharedPtr<FFormatterInterface> Formatt
 		{
 			if (OffsetX != 0)
 			{
-				Node->Modify();
+				ModifyNodeForMove(Node);
 				Node->NodePosY += OffsetX;
 			}
 
@@ -864,6 +869,15 @@ void FBAGraphHandler::MoveUnrelatedNodes(TSharedPtr<FFormatterInterface> Formatt
 
 void FBAGraphHandler::OnGraphChanged(const FEdGraphEditAction& Action)
 {
+	INC_DWORD_STAT(STAT_GraphHandler_GraphChangedNotifications);
+
+	// links and removed nodes still broadcast while formatting, only react once the batch is done
+	if (NodeMoveBatchCount > 0)
+	{
+		bGraphChangedDuringNodeMoveBatch = true;
+		return;
+	}
+
 	DelayedDetectGraphChanges.StartDelay(1);
 }
 
@@ -2042,8 +2056,27 @@ FSlateRect FBAGraphHandler::GetCachedNodeBounds(UEdGraphNode* Node, bool bWithCo
 		return FSlateRect();
 	}
 
+	if (FormatGeometry.IsValid())
+	{
+		return FormatGeometry->GetNodeBounds(Node, bWithCommentBubble);
+	}
+
 	FVector2D Pos(Node->NodePosX, Node->NodePosY);
+	FIntPoint Size = CalculateNodeSize(Node);
 
+	if (bWithCommentBubble && Node->bCommentBubbleVisible)
+	{
+		const FIntPoint BubbleSize = GetCommentBubbleSize(Node);
+		Pos.Y -= BubbleSize.Y;
+		Size.Y += BubbleSize.Y;
+		Size.X = FMath::Max(Size.X, BubbleSize.X);
+	}
+
+	return FSlateRect::FromPointAndExtent(Pos, Size);
+}
+
+FIntPoint FBAGraphHandler::CalculateNodeSize(UEdGraphNode* Node)
+{
 	FIntPoint Size(300, 150);
 	if (FBAUtils::IsKnotNode(Node))
 	{
@@ -2068,22 +2101,21 @@ FSlateRect FBAGraphHandler::GetCachedNodeBounds(UEdGraphNode* Node, bool bWithCo
 		}
 	}
 
+	return Size;
+}
+
+FIntPoint FBAGraphHandler::GetCommentBubbleSize(UEdGraphNode* Node)
+{
 	if (!FBAUtils::IsCommentNode(Node))
 	{
 		const FBANodeData& FoundNodeData = GetNodeData(Node);
 		if (FoundNodeData.HasCommentBubbleSize())
 		{
-			const FIntPoint& BubbleSize = FoundNodeData.GetCommentBubbleSize();
-			if (bWithCommentBubble && Node->bCommentBubbleVisible)
-			{
-				Pos.Y -= BubbleSize.Y;
-				Size.Y += BubbleSize.Y;
-				Size.X = FMath::Max(Size.X, BubbleSize.X);
-			}
+			return FoundNodeData.GetCommentBubbleSize();
 		}
 	}
 
-	return FSlateRect::FromPointAndExtent(Pos, Size);
+	return FIntPoint::ZeroValue;
 }
 
 UEdGraphPin* FBAGraphHandler::GetSelectedPin()
@@ -2209,10 +2241,29 @@ int32 FBAGraphHandler::GetPinY(const UEdGraphPin* Pin)
 		return 0;
 	}
 
+	if (FormatGeometry.IsValid())
+	{
+		return FormatGeometry->GetPinY(Pin);
+	}
+
+	float PinOffset = 0.0f;
+	if (CalculatePinOffset(Pin, PinOffset))
+	{
+		return FMath::RoundToInt(OwningNode->NodePosY + PinOffset);
+	}
+
+	return OwningNode->NodePosY;
+}
+
+bool FBAGraphHandler::CalculatePinOffset(const UEdGraphPin* Pin, float& OutOffset)
+{
+	UEdGraphNode* OwningNode = Pin->GetOwningNode();
+
 	const FBANodeData& FoundNodeData = GetNodeData(OwningNode);
 	if (const float* FoundPinOffset = FoundNodeData.CachedPins.Find(Pin->PinId))
 	{
-		return FMath::RoundToInt(OwningNode->NodePosY + *FoundPinOffset);
+		OutOffset = *FoundPinOffset;
+		return true;
 	}
 
 	// cache pin offset
@@ -2227,13 +2278,155 @@ int32 FBAGraphHandler::GetPinY(const UEdGraphPin* Pin)
 			{
 				if (GraphPin->GetPinObj() != nullptr)
 				{
-					return FMath::RoundToInt(OwningNode->NodePosY + GraphPin->GetNodeOffset().Y);
+					OutOffset = GraphPin->GetNodeOffset().Y;
+					return true;
 				}
 			}
 		}
 	}
 
-	return OwningNode->NodePosY;
+	return false;
+}
+
+void FBAGraphHandler::ModifyNodeForMove(UEdGraphNode* Node)
+{
+	if (!Node)
+	{
+		return;
+	}
+
+	if (NodeMoveBatchCount == 0)
+	{
+		Node->Modify();
+		return;
+	}
+
+	if (!PendingNodeMoves.Contains(Node))
+	{
+		PendingNodeMoves.Add(Node, FIntPoint(Node->NodePosX, Node->NodePosY));
+	}
+}
+
+void FBAGraphHandler::FlushNodeMoves()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FBAGraphHandler::FlushNodeMoves"), STAT_GraphHandler_FlushNodeMoves, STATGROUP_BA_EdGraphFormatter);
+
+	for (auto It = PendingNodeMoves.CreateIterator(); It; ++It)
+	{
+		UEdGraphNode* Node = It.Key();
+		if (!IsValid(Node))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		const FIntPoint& OriginalPos = It.Value();
+		const FIntPoint NewPos(Node->NodePosX, Node->NodePosY);
+		if (NewPos == OriginalPos)
+		{
+			// may still move later in the pass
+			continue;
+		}
+
+		// save the node at its original position, then put the formatted position back
+		Node->NodePosX = OriginalPos.X;
+		Node->NodePosY = OriginalPos.Y;
+		Node->Modify();
+		Node->NodePosX = NewPos.X;
+		Node->NodePosY = NewPos.Y;
+
+		INC_DWORD_STAT(STAT_GraphHandler_NodesSavedForUndo);
+		It.RemoveCurrent();
+	}
+}
+
+void FBAGraphHandler::BeginNodeMoveBatch()
+{
+	++NodeMoveBatchCount;
+}
+
+void FBAGraphHandler::EndNodeMoveBatch()
+{
+	check(NodeMoveBatchCount > 0);
+	if (--NodeMoveBatchCount > 0)
+	{
+		return;
+	}
+
+	FlushNodeMoves();
+
+	INC_DWORD_STAT_BY(STAT_GraphHandler_NodesSkippedForUndo, PendingNodeMoves.Num());
+	PendingNodeMoves.Reset();
+
+	UEdGraph* Graph = GetFocusedEdGraph();
+	if (NodesAddedDuringNodeMoveBatch.Num() > 0 && Graph)
+	{
+		// skip the nodes which were removed again during the batch
+		const TSet<UEdGraphNode*> GraphNodes(Graph->Nodes);
+
+		FEdGraphEditAction AddNodesAction(GRAPHACTION_AddNode, Graph, nullptr, false);
+		for (TWeakObjectPtr<UEdGraphNode> WeakNode : NodesAddedDuringNodeMoveBatch)
+		{
+			if (WeakNode.IsValid() && GraphNodes.Contains(WeakNode.Get()))
+			{
+				AddNodesAction.Nodes.Add(WeakNode.Get());
+			}
+		}
+
+		if (AddNodesAction.Nodes.Num() > 0)
+		{
+			Graph->NotifyGraphChanged(AddNodesAction);
+		}
+	}
+
+	NodesAddedDuringNodeMoveBatch.Reset();
+
+	if (bGraphChangedDuringNodeMoveBatch)
+	{
+		bGraphChangedDuringNodeMoveBatch = false;
+		DelayedDetectGraphChanges.StartDelay(1);
+	}
+}
+
+void FBAGraphHandler::AddNodeAddedDuringNodeMoveBatch(UEdGraphNode* Node)
+{
+	check(NodeMoveBatchCount > 0);
+	NodesAddedDuringNodeMoveBatch.Add(Node);
+}
+
+FBANodeMoveBatchScope::FBANodeMoveBatchScope(TSharedPtr<FBAGraphHandler> InGraphHandler)
+	: GraphHandler(InGraphHandler)
+{
+	if (GraphHandler.IsValid())
+	{
+		GraphHandler->BeginNodeMoveBatch();
+	}
+}
+
+FBANodeMoveBatchScope::~FBANodeMoveBatchScope()
+{
+	if (GraphHandler.IsValid())
+	{
+		GraphHandler->EndNodeMoveBatch();
+	}
+}
+
+void FBAGraphHandler::BeginFormatGeometry()
+{
+	if (FormatGeometryScopeCount++ == 0)
+	{
+		FormatGeometry = MakeShared<FBAFormatGeometry>();
+		FormatGeometry->Init(AsShared());
+	}
+}
+
+void FBAGraphHandler::EndFormatGeometry()
+{
+	check(FormatGeometryScopeCount > 0);
+	if (--FormatGeometryScopeCount == 0)
+	{
+		FormatGeometry.Reset();
+	}
 }
 
 void FBAGraphHandler::UpdateCachedNodeSize(float DeltaTime)
@@ -2604,208 +2797,222 @@ void FBAGraphHandler::SimpleFormatAll()
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FBAGraphHandler::FormatAll"), STAT_GraphHandler_FormatAll, STATGROUP_BA_EdGraphFormatter);
 
-	TSet<UEdGraphNode*> FormattedNodes;
-	TOptional<FSlateRect> FormattedBounds;
+	// the batch has to be flushed (which saves the moved nodes) before the transaction is closed
+	{
+		FBAFormatGeometryScope FormatGeometryScope(AsShared());
+		FBANodeMoveBatchScope NodeMoveBatchScope(AsShared());
 
-	float ColumnX = 0.0f;
-	TArray<TSharedPtr<FFormatterInterface>> AllFormatters;
+		TSet<UEdGraphNode*> FormattedNodes;
+		TOptional<FSlateRect> FormattedBounds;
 
-	bool bFirstColumn = true;
+		float ColumnX = 0.0f;
+		TArray<TSharedPtr<FFormatterInterface>> AllFormatters;
 
-	for (int i = 0; i < FormatAllColumns.Num(); ++i)
-	{
-		TArray<TSharedPtr<FFormatterInterface>> ColumnFormatters;
+		bool bFirstColumn = true;
 
-		// pass through the current column and format all the nodes
-		for (TWeakObjectPtr<UEdGraphNode> WeakPtr : FormatAllColumns[i])
+		for (int i = 0; i < FormatAllColumns.Num(); ++i)
 		{
-			if (!WeakPtr.IsValid())
-			{
-				continue;
-			}
+			TArray<TSharedPtr<FFormatterInterface>> ColumnFormatters;
 
-			UEdGraphNode* Node = WeakPtr.Get();
-			if (FormattedNodes.Contains(Node))
+			// pass through the current column and format all the nodes
+			for (TWeakObjectPtr<UEdGraphNode> WeakPtr : FormatAllColumns[i])
 			{
-				continue;
-			}
+				if (!WeakPtr.IsValid())
+				{
+					continue;
+				}
 
-			Node->Modify();
+				UEdGraphNode* Node = WeakPtr.Get();
+				if (FormattedNodes.Contains(Node))
+				{
+					continue;
+				}
 
-			// ignore previously formatted nodes, these can be overlapping if they are shared parameter nodes
-			FormatterParameters.IgnoredNodes.GetNodesWeak() = FBAMiscUtils::AsWeakObjectPtrArray(FormattedNodes.Array());
-			TSharedPtr<FFormatterInterface> Formatter = FormatNodes(Node, true);
+				ModifyNodeForMove(Node);
 
-			if (!Formatter.IsValid())
-			{
-				continue;
-			}
+				// ignore previously formatted nodes, these can be overlapping if they are shared parameter nodes
+				FormatterParameters.IgnoredNodes.GetNodesWeak() = FBAMiscUtils::AsWeakObjectPtrArray(FormattedNodes.Array());
+				TSharedPtr<FFormatterInterface> Formatter = FormatNodes(Node, true);
 
-			FormattedNodes.Append(Formatter->GetFormattedNodes());
+				if (!Formatter.IsValid())
+				{
+					continue;
+				}
 
-			ColumnFormatters.Add(Formatter);
-			AllFormatters.Add(Formatter);
-		}
+				FormattedNodes.Append(Formatter->GetFormattedNodes());
 
-		if (!ColumnFormatters.Num())
-		{
-			continue;
-		}
+				ColumnFormatters.Add(Formatter);
+				AllFormatters.Add(Formatter);
+			}
 
-		// offset column x by the comment
-		float CommentOffset = 0;
-		for (TSharedPtr<FFormatterInterface> Formatter : ColumnFormatters)
-		{
-			TSet<UEdGraphNode*> FormatterNodes = Formatter->GetFormattedNodes();
-			FSlateRect CommentBounds = FBAUtils::GetCachedNodeArrayBoundsWithComments(AsShared(), Formatter->GetCommentHandler(), Formatter->GetFormattedNodes().Array());
-			FSlateRect NodeBounds = FBAUtils::GetCachedNodeArrayBounds(AsShared(), Formatter->GetFormattedNodes().Array());
+			if (!ColumnFormatters.Num())
+			{
+				continue;
+			}
 
-			if (!bFirstColumn) // don't use comment offset on the first column 
+			// offset column x by the comment
+			float CommentOffset = 0;
+			for (TSharedPtr<FFormatterInterface> Formatter : ColumnFormatters)
 			{
-				CommentOffset = FMath::Max(CommentOffset, NodeBounds.Left - CommentBounds.Left);
+				TSet<UEdGraphNode*> FormatterNodes = Formatter->GetFormattedNodes();
+				FSlateRect CommentBounds = FBAUtils::GetCachedNodeArrayBoundsWithComments(AsShared(), Formatter->GetCommentHandler(), Formatter->GetFormattedNodes().Array());
+				FSlateRect NodeBounds = FBAUtils::GetCachedNodeArrayBounds(AsShared(), Formatter->GetFormattedNodes().Array());
+
+				if (!bFirstColumn) // don't use comment offset on the first column 
+				{
+					CommentOffset = FMath::Max(CommentOffset, NodeBounds.Left - CommentBounds.Left);
+				}
 			}
-		}
 
-		ColumnX += CommentOffset;
+			ColumnX += CommentOffset;
 
-		// position the formatters at the correctly column X
-		FormatColumn(ColumnFormatters, ColumnX);
+			// position the formatters at the correctly column X
+			FormatColumn(ColumnFormatters, ColumnX);
 
-		// calculate the new x position for the next column
-		FSlateRect ColumnBounds = FBAFormatterUtils::GetFormatterArrayBounds(ColumnFormatters, AsShared(), UBASettings::Get().bApplyCommentPadding);
-		ColumnX = ColumnBounds.Right + UBASettings::Get().FormatAllPadding.X;
-		ColumnX = FBAUtils::AlignTo8x8Grid(ColumnX, EBARoundingMethod::Ceil);
+			// calculate the new x position for the next column
+			FSlateRect ColumnBounds = FBAFormatterUtils::GetFormatterArrayBounds(ColumnFormatters, AsShared(), UBASettings::Get().bApplyCommentPadding);
+			ColumnX = ColumnBounds.Right + UBASettings::Get().FormatAllPadding.X;
+			ColumnX = FBAUtils::AlignTo8x8Grid(ColumnX, EBARoundingMethod::Ceil);
 
-		bFirstColumn = false;
-	}
+			bFirstColumn = false;
+		}
 
-	// the Metasound Graph requires you to move nodes via GraphNode::MoveTo, so it's easier to do it once here 
-	for (UEdGraphNode* Node : FormattedNodes)
-	{
-		if (TSharedPtr<SGraphNode> GraphNode = FBAUtils::GetGraphNode(GetGraphPanel(), Node))
+		// the Metasound Graph requires you to move nodes via GraphNode::MoveTo, so it's easier to do it once here 
+		for (UEdGraphNode* Node : FormattedNodes)
 		{
-			TSet<TWeakPtr<SNodePanel::SNode>> NodeSet;
-			FVector2D NodePos(Node->NodePosX, Node->NodePosY);
-			GraphNode->MoveTo(NodePos, NodeSet);
+			if (TSharedPtr<SGraphNode> GraphNode = FBAUtils::GetGraphNode(GetGraphPanel(), Node))
+			{
+				TSet<TWeakPtr<SNodePanel::SNode>> NodeSet;
+				FVector2D NodePos(Node->NodePosX, Node->NodePosY);
+				GraphNode->MoveTo(NodePos, NodeSet);
+			}
 		}
+
+		FormatAllColumns.Empty();
+		PostFormatting(AllFormatters);
 	}
 
-	FormatAllColumns.Empty();
-	PostFormatting(AllFormatters);
 	FormatAllTransaction.Reset();
 }
 
 void FBAGraphHandler::SmartFormatAll()
 {
-	TSharedPtr<FBACommentContainsGraph> MasterContainsGraph = MakeShared<FBACommentContainsGraph>();
-	MasterContainsGraph->Init(AsShared());
-	MasterContainsGraph->BuildCommentTree();
+	// the batch has to be flushed (which saves the moved nodes) before the transaction is closed
+	{
+		FBAFormatGeometryScope FormatGeometryScope(AsShared());
+		FBANodeMoveBatchScope NodeMoveBatchScope(AsShared());
 
-	TArray<TSharedPtr<FFormatterInterface>> AllFormatterSaved;
-	TArray<TSharedPtr<FFormatterInterface>> AllFormatters;
+		TSharedPtr<FBACommentContainsGraph> MasterContainsGraph = MakeShared<FBACommentContainsGraph>();
+		MasterContainsGraph->Init(AsShared());
+		MasterContainsGraph->BuildCommentTree();
 
-	// format all the nodes
-	TSet<UEdGraphNode*> PreviouslyFormattedNodes;
+		TArray<TSharedPtr<FFormatterInterface>> AllFormatterSaved;
+		TArray<TSharedPtr<FFormatterInterface>> AllFormatters;
 
-	for (TWeakObjectPtr<UEdGraphNode> WeakPtr : FormatAllColumns[0])
-	{
-		UEdGraphNode* Node = WeakPtr.Get();
-		if (PreviouslyFormattedNodes.Contains(Node))
-		{
-			continue;
-		}
+		// format all the nodes
+		TSet<UEdGraphNode*> PreviouslyFormattedNodes;
 
-		Node->Modify();
+		for (TWeakObjectPtr<UEdGraphNode> WeakPtr : FormatAllColumns[0])
+		{
+			UEdGraphNode* Node = WeakPtr.Get();
+			if (PreviouslyFormattedNodes.Contains(Node))
+			{
+				continue;
+			}
 
-		TSharedPtr<FFormatterInterface> Formatter = FormatNodes(Node, true);
-		AllFormatterSaved.Add(Formatter);
+			ModifyNodeForMove(Node);
 
-		PreviouslyFormattedNodes.Append(Formatter->GetFormattedNodes());
-	}
+			TSharedPtr<FFormatterInterface> Formatter = FormatNodes(Node, true);
+			AllFormatterSaved.Add(Formatter);
 
-	AllFormatters = AllFormatterSaved;
+			PreviouslyFormattedNodes.Append(Formatter->GetFormattedNodes());
+		}
 
-	int NumColumns = 0;
-	float ColumnX = 0;
+		AllFormatters = AllFormatterSaved;
 
-	while (AllFormatters.Num() > 0)
-	{
-		TArray<TSharedPtr<FFormatterInterface>> AllFormattersCopy = AllFormatters;
+		int NumColumns = 0;
+		float ColumnX = 0;
 
-		// sort formatted nodes by left most
-		AllFormattersCopy.Sort([](TSharedPtr<FFormatterInterface> FormatterA, TSharedPtr<FFormatterInterface> FormatterB)
+		while (AllFormatters.Num() > 0)
 		{
-			UEdGraphNode* RootA = FormatterA->GetRootNode();
-			UEdGraphNode* RootB = FormatterB->GetRootNode();
-			if (RootA->NodePosX != RootB->NodePosX)
-			{
-				return RootA->NodePosX < RootB->NodePosX;
-			}
+			TArray<TSharedPtr<FFormatterInterface>> AllFormattersCopy = AllFormatters;
 
-			return RootA->NodePosY < RootB->NodePosY;
-		});
+			// sort formatted nodes by left most
+			AllFormattersCopy.Sort([](TSharedPtr<FFormatterInterface> FormatterA, TSharedPtr<FFormatterInterface> FormatterB)
+			{
+				UEdGraphNode* RootA = FormatterA->GetRootNode();
+				UEdGraphNode* RootB = FormatterB->GetRootNode();
+				if (RootA->NodePosX != RootB->NodePosX)
+				{
+					return RootA->NodePosX < RootB->NodePosX;
+				}
 
-		TOptional<float> RightMost;
-		TArray<TSharedPtr<FFormatterInterface>> CurrentColumn;
+				return RootA->NodePosY < RootB->NodePosY;
+			});
 
-		float CommentOffset = 0;
+			TOptional<float> RightMost;
+			TArray<TSharedPtr<FFormatterInterface>> CurrentColumn;
 
-		// create columns by checking for overlapping formatted node-trees
-		for (TSharedPtr<FFormatterInterface> Formatter : AllFormattersCopy)
-		{
-			TSet<UEdGraphNode*> FormatterNodes = Formatter->GetFormattedNodes();
-			FSlateRect CommentBounds = FBAUtils::GetCachedNodeArrayBoundsWithComments(AsShared(), Formatter->GetCommentHandler(), Formatter->GetFormattedNodes().Array());
-			FSlateRect NodeBounds = FBAUtils::GetCachedNodeArrayBounds(AsShared(), Formatter->GetFormattedNodes().Array());
-			FSlateRect Bounds = UBASettings::Get().bApplyCommentPadding ? CommentBounds : NodeBounds;
+			float CommentOffset = 0;
 
-			if (!RightMost.IsSet())
-			{
-				RightMost = Bounds.Right;
-			}
-			else if (Bounds.Left < RightMost.GetValue())
+			// create columns by checking for overlapping formatted node-trees
+			for (TSharedPtr<FFormatterInterface> Formatter : AllFormattersCopy)
 			{
-				RightMost = FMath::Max(RightMost.GetValue(), Bounds.Right);
-			}
-			else
-			{
-				// this node is not in this column, skip it
-				continue;
-			}
+				TSet<UEdGraphNode*> FormatterNodes = Formatter->GetFormattedNodes();
+				FSlateRect CommentBounds = FBAUtils::GetCachedNodeArrayBoundsWithComments(AsShared(), Formatter->GetCommentHandler(), Formatter->GetFormattedNodes().Array());
+				FSlateRect NodeBounds = FBAUtils::GetCachedNodeArrayBounds(AsShared(), Formatter->GetFormattedNodes().Array());
+				FSlateRect Bounds = UBASettings::Get().bApplyCommentPadding ? CommentBounds : NodeBounds;
 
-			if (NumColumns > 0)
-			{
-				CommentOffset = FMath::Max(CommentOffset, NodeBounds.Left - CommentBounds.Left);
-			}
+				if (!RightMost.IsSet())
+				{
+					RightMost = Bounds.Right;
+				}
+				else if (Bounds.Left < RightMost.GetValue())
+				{
+					RightMost = FMath::Max(RightMost.GetValue(), Bounds.Right);
+				}
+				else
+				{
+					// this node is not in this column, skip it
+					continue;
+				}
 
-			CurrentColumn.Add(Formatter);
-			AllFormatters.Remove(Formatter);
-		}
+				if (NumColumns > 0)
+				{
+					CommentOffset = FMath::Max(CommentOffset, NodeBounds.Left - CommentBounds.Left);
+				}
 
-		GraphOverlay->DrawBounds(FBAFormatterUtils::GetFormatterArrayBounds(CurrentColumn, AsShared(), true));
+				CurrentColumn.Add(Formatter);
+				AllFormatters.Remove(Formatter);
+			}
 
-		ColumnX += CommentOffset;
+			GraphOverlay->DrawBounds(FBAFormatterUtils::GetFormatterArrayBounds(CurrentColumn, AsShared(), true));
 
-		FormatColumn(CurrentColumn, ColumnX);
+			ColumnX += CommentOffset;
 
-		FSlateRect ColumnBounds = FBAFormatterUtils::GetFormatterArrayBounds(CurrentColumn, AsShared(), UBASettings::Get().bApplyCommentPadding);
-		ColumnX = ColumnBounds.Right + UBASettings::Get().FormatAllPadding.X;
-		ColumnX = FBAUtils::AlignTo8x8Grid(ColumnX, EBARoundingMethod::Ceil);
-		NumColumns += 1;
-	}
+			FormatColumn(CurrentColumn, ColumnX);
 
-	// the Metasound Graph requires you to move nodes via GraphNode::MoveTo, so it's easier to do it once here 
-	for (UEdGraphNode* Node : PreviouslyFormattedNodes)
-	{
-		if (TSharedPtr<SGraphNode> GraphNode = FBAUtils::GetGraphNode(GetGraphPanel(), Node))
+			FSlateRect ColumnBounds = FBAFormatterUtils::GetFormatterArrayBounds(CurrentColumn, AsShared(), UBASettings::Get().bApplyCommentPadding);
+			ColumnX = ColumnBounds.Right + UBASettings::Get().FormatAllPadding.X;
+			ColumnX = FBAUtils::AlignTo8x8Grid(ColumnX, EBARoundingMethod::Ceil);
+			NumColumns += 1;
+		}
+
+		// the Metasound Graph requires you to move nodes via GraphNode::MoveTo, so it's easier to do it once here 
+		for (UEdGraphNode* Node : PreviouslyFormattedNodes)
 		{
-			TSet<TWeakPtr<SNodePanel::SNode>> NodeSet;
-			FVector2D NodePos(Node->NodePosX, Node->NodePosY);
-			GraphNode->MoveTo(NodePos, NodeSet);
+			if (TSharedPtr<SGraphNode> GraphNode = FBAUtils::GetGraphNode(GetGraphPanel(), Node))
+			{
+				TSet<TWeakPtr<SNodePanel::SNode>> NodeSet;
+				FVector2D NodePos(Node->NodePosX, Node->NodePosY);
+				GraphNode->MoveTo(NodePos, NodeSet);
+			}
 		}
+
+		FormatAllColumns.Empty();
+		PostFormatting(AllFormatters);
 	}
 
-	FormatAllColumns.Empty();
-	PostFormatting(AllFormatters);
 	FormatAllTransaction.Reset();
 }
 
@@ -3265,6 +3472,9 @@ TSharedPtr<FFormatterInterface> FBAGraphHandler::FormatNodes(UEdGraphNode* Node,
 		return nullptr;
 	}
 
+	FBAFormatGeometryScope FormatGeometryScope(AsShared());
+	FBANodeMoveBatchScope NodeMoveBatchScope(AsShared());
+
 	TSharedPtr<FFormatterInterface> Formatter;
 
 	const bool bCheckSelectedNode = !bUsingFormatAll; // don't check selected node if we are running format all command
@@ -3294,14 +3504,17 @@ TSharedPtr<FFormatterInterface> FBAGraphHandler::FormatNodes(UEdGraphNode* Node,
 
 	if (FBAUtils::IsBlueprintGraph(EdGraph))
 	{
-		if (FormatterMap.Contains(NodeToFormat) && UBASettings::Get().bEnableFasterFormatting)
+		// formatters are kept per root so an unchanged tree replays its last layout (see FEdGraphFormatter::IsFormattingRequired)
+		if (TSharedPtr<FFormatterInterface>* CachedFormatter = FormatterMap.Find(NodeToFormat))
 		{
-			Formatter = FormatterMap[NodeToFormat];
-			Formatter->GetFormatterParameters().MasterContainsGraph = FormatterParameters.MasterContainsGraph;
+			Formatter = *CachedFormatter;
+			Formatter->GetFormatterParameters() = FormatterParameters;
 		}
 		else
 		{
-			Formatter = MakeShared<FEdGraphFormatter>(AsShared(), FormatterParameters);
+			TSharedPtr<FEdGraphFormatter> NewFormatter = MakeShared<FEdGraphFormatter>(AsShared(), FormatterParameters);
+			NewFormatter->EnableLayoutReplay();
+			Formatter = NewFormatter;
 			FormatterMap.Add(NodeToFormat, Formatter);
 		}
 	}
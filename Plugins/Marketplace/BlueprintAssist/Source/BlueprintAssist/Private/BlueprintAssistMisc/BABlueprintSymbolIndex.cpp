@@ -0,0 +1,256 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BlueprintAssistMisc/BABlueprintSymbolIndex.h"
+
+#include "BlueprintAssistStats.h"
+#include "BlueprintAssistUtils.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_Event.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("SymbolIndex Graphs Scanned"), STAT_SymbolIndex_GraphsScanned, STATGROUP_BA_EdGraphFormatter);
+
+FBABlueprintSymbolIndex::~FBABlueprintSymbolIndex()
+{
+	Reset();
+}
+
+void FBABlueprintSymbolIndex::Init(UBlueprint* InBlueprint)
+{
+	Reset();
+	Blueprint = InBlueprint;
+}
+
+void FBABlueprintSymbolIndex::Reset()
+{
+	for (FGraphEntry& Entry : Graphs)
+	{
+		UnbindGraph(Entry);
+	}
+
+	Graphs.Empty();
+	Blueprint.Reset();
+	bGraphsDirty = true;
+}
+
+void FBABlueprintSymbolIndex::GetSymbols(TArray<FBABlueprintSymbol>& OutSymbols)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FBABlueprintSymbolIndex::GetSymbols"), STAT_SymbolIndex_GetSymbols, STATGROUP_BA_EdGraphFormatter);
+
+	OutSymbols.Reset();
+
+	if (bGraphsDirty)
+	{
+		UpdateGraphs();
+	}
+
+	for (FGraphEntry& Entry : Graphs)
+	{
+		UEdGraph* Graph = Entry.Graph.Get();
+		if (!Graph)
+		{
+			continue;
+		}
+
+		if (Entry.bIsUbergraph)
+		{
+			if (Entry.bEventNodesDirty)
+			{
+				UpdateEventNodes(Entry);
+			}
+
+			for (const TWeakObjectPtr<UEdGraphNode>& EventNode : Entry.EventNodes)
+			{
+				if (EventNode.IsValid())
+				{
+					FBABlueprintSymbol& Symbol = OutSymbols.AddDefaulted_GetRef();
+					Symbol.EventNode = EventNode.Get();
+					Symbol.Graph = Graph;
+				}
+			}
+		}
+
+		// add the graph itself
+		FBABlueprintSymbol& GraphSymbol = OutSymbols.AddDefaulted_GetRef();
+		GraphSymbol.Graph = Graph;
+	}
+}
+
+void FBABlueprintSymbolIndex::UpdateGraphs()
+{
+	bGraphsDirty = false;
+
+	UBlueprint* BlueprintPtr = Blueprint.Get();
+	if (!BlueprintPtr)
+	{
+		Reset();
+		return;
+	}
+
+	TArray<UEdGraph*> BlueprintGraphs;
+	BlueprintPtr->GetAllGraphs(BlueprintGraphs);
+
+	// keep the entries of graphs we already know about, their event nodes are still up to date
+	TArray<FGraphEntry> OldGraphs = MoveTemp(Graphs);
+	Graphs.Reset(BlueprintGraphs.Num());
+
+	for (UEdGraph* Graph : BlueprintGraphs)
+	{
+		if (!Graph || BlueprintPtr->DelegateSignatureGraphs.Contains(Graph))
+		{
+			continue;
+		}
+
+		const int32 OldIndex = OldGraphs.IndexOfByPredicate([Graph](const FGraphEntry& Entry) { return Entry.Graph.Get() == Graph; });
+		if (OldIndex != INDEX_NONE)
+		{
+			Graphs.Add(MoveTemp(OldGraphs[OldIndex]));
+			OldGraphs.RemoveAtSwap(OldIndex, 1, false);
+			continue;
+		}
+
+		FGraphEntry& Entry = Graphs.AddDefaulted_GetRef();
+		Entry.Graph = Graph;
+		Entry.bIsUbergraph = FBAUtils::GetGraphType(Graph) == GT_Ubergraph;
+
+		if (Entry.bIsUbergraph)
+		{
+			Entry.OnGraphChangedHandle = Graph->AddOnGraphChangedHandler(
+				FOnGraphChanged::FDelegate::CreateRaw(this, &FBABlueprintSymbolIndex::OnGraphChanged, TWeakObjectPtr<UEdGraph>(Graph)));
+		}
+	}
+
+	for (FGraphEntry& Removed : OldGraphs)
+	{
+		UnbindGraph(Removed);
+	}
+}
+
+void FBABlueprintSymbolIndex::UpdateEventNodes(FGraphEntry& Entry)
+{
+	Entry.bEventNodesDirty = false;
+	Entry.EventNodes.Reset();
+
+	UEdGraph* Graph = Entry.Graph.Get();
+	if (!Graph)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_SymbolIndex_GraphsScanned);
+
+	TArray<UEdGraphNode*> EventNodes = Graph->Nodes.FilterByPredicate(&FBABlueprintSymbolIndex::IsSymbolEventNode);
+
+	EventNodes.StableSort([](const UEdGraphNode& NodeA, const UEdGraphNode& NodeB)
+	{
+		return GetEventNodeOrder(&NodeA) < GetEventNodeOrder(&NodeB);
+	});
+
+	Entry.EventNodes.Reserve(EventNodes.Num());
+	for (UEdGraphNode* Node : EventNodes)
+	{
+		Entry.EventNodes.Add(Node);
+	}
+}
+
+void FBABlueprintSymbolIndex::UnbindGraph(FGraphEntry& Entry)
+{
+	if (Entry.OnGraphChangedHandle.IsValid())
+	{
+		if (UEdGraph* Graph = Entry.Graph.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(Entry.OnGraphChangedHandle);
+		}
+
+		Entry.OnGraphChangedHandle.Reset();
+	}
+}
+
+void FBABlueprintSymbolIndex::OnGraphChanged(const FEdGraphEditAction& Action, TWeakObjectPtr<UEdGraph> Graph)
+{
+	FGraphEntry* Entry = FindEntry(Graph.Get());
+	if (!Entry || Entry->bEventNodesDirty)
+	{
+		return;
+	}
+
+	// selection doesn't change the symbols
+	if (Action.Action == GRAPHACTION_SelectNode)
+	{
+		return;
+	}
+
+	// a default action is sent for undo / redo and any other bulk change, rescan the graph next time the symbols are requested
+	if (Action.Action == GRAPHACTION_Default)
+	{
+		Entry->bEventNodesDirty = true;
+		return;
+	}
+
+	if (Action.Action & GRAPHACTION_RemoveNode)
+	{
+		Entry->EventNodes.RemoveAll([&Action](const TWeakObjectPtr<UEdGraphNode>& EventNode)
+		{
+			return !EventNode.IsValid() || Action.Nodes.Contains(EventNode.Get());
+		});
+	}
+
+	if (Action.Action & GRAPHACTION_AddNode)
+	{
+		for (const UEdGraphNode* Node : Action.Nodes)
+		{
+			if (!IsSymbolEventNode(Node))
+			{
+				continue;
+			}
+
+			UEdGraphNode* EventNode = const_cast<UEdGraphNode*>(Node);
+			if (Entry->EventNodes.Contains(EventNode))
+			{
+				continue;
+			}
+
+			// insert after the last event node with the same order to match the stable sort in UpdateEventNodes
+			const int32 Order = GetEventNodeOrder(EventNode);
+			int32 InsertIndex = Entry->EventNodes.Num();
+			while (InsertIndex > 0 && (!Entry->EventNodes[InsertIndex - 1].IsValid() || GetEventNodeOrder(Entry->EventNodes[InsertIndex - 1].Get()) > Order))
+			{
+				--InsertIndex;
+			}
+
+			Entry->EventNodes.Insert(EventNode, InsertIndex);
+		}
+	}
+}
+
+FBABlueprintSymbolIndex::FGraphEntry* FBABlueprintSymbolIndex::FindEntry(const UEdGraph* Graph)
+{
+	if (!Graph)
+	{
+		return nullptr;
+	}
+
+	return Graphs.FindByPredicate([Graph](const FGraphEntry& Entry) { return Entry.Graph.Get() == Graph; });
+}
+
+bool FBABlueprintSymbolIndex::IsSymbolEventNode(const UEdGraphNode* Node)
+{
+	return Node && Node->GetClass()->ImplementsInterface(UK2Node_EventNodeInterface::StaticClass());
+}
+
+int32 FBABlueprintSymbolIndex::GetEventNodeOrder(const UEdGraphNode* Node)
+{
+	if (Node->GetClass() == UK2Node_Event::StaticClass())
+	{
+		return 0;
+	}
+
+	if (Node->GetClass() == UK2Node_CustomEvent::StaticClass())
+	{
+		return 1;
+	}
+
+	return 2;
+}
@@ -0,0 +1,190 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BlueprintAssistMisc/BAGraphHealth.h"
+
+#include "BlueprintAssistCache.h"
+#include "BlueprintAssistUtils.h"
+#include "K2Node_Knot.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+
+namespace BAGraphHealth
+{
+	static bool FindCachedBounds(const FBAGraphData& GraphData, UEdGraphNode* Node, FSlateRect& OutBounds)
+	{
+		const FBANodeData* NodeData = GraphData.NodeData.Find(FBAUtils::GetNodeGuid(Node));
+		if (!NodeData || !NodeData->HasSize())
+		{
+			return false;
+		}
+
+		OutBounds = FSlateRect::FromPointAndExtent(FVector2D(Node->NodePosX, Node->NodePosY), NodeData->GetNodeSize());
+		return true;
+	}
+}
+
+void FBAGraphHealth::DetectKnotIssues(UEdGraph* Graph, TArray<FBAGraphIssue>& OutIssues)
+{
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		UK2Node_Knot* KnotNode = Cast<UK2Node_Knot>(Node);
+		if (!KnotNode)
+		{
+			continue;
+		}
+
+		// Detect empty knot nodes to be deleted
+		if (FBAUtils::GetLinkedPins(KnotNode).Num() == 0)
+		{
+			FBAGraphIssue& Issue = OutIssues.AddDefaulted_GetRef();
+			Issue.Type = EBAGraphIssueType::UnlinkedKnot;
+			Issue.Severity = EMessageSeverity::Info;
+			Issue.Message = FString::Printf(TEXT("Unlinked reroute node %s"), *KnotNode->NodeGuid.ToString());
+			Issue.Node = KnotNode;
+			continue;
+		}
+
+		// Detect badly linked exec knot nodes
+		for (UEdGraphPin* Pin : FBAUtils::GetLinkedPins(KnotNode, EGPD_Output).FilterByPredicate(FBAUtils::IsExecPin))
+		{
+			if (Pin->LinkedTo.Num() > 1)
+			{
+				FBAGraphIssue& Issue = OutIssues.AddDefaulted_GetRef();
+				Issue.Type = EBAGraphIssueType::BadlyLinkedKnot;
+				Issue.Severity = EMessageSeverity::Error;
+				Issue.Message = FString::Printf(TEXT("Badly linked reroute node (manually delete and remake this node) %s"), *KnotNode->NodeGuid.ToString());
+				Issue.Node = KnotNode;
+			}
+		}
+	}
+}
+
+void FBAGraphHealth::DetectDanglingKnots(UEdGraph* Graph, TArray<FBAGraphIssue>& OutIssues)
+{
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		UK2Node_Knot* KnotNode = Cast<UK2Node_Knot>(Node);
+		if (!KnotNode)
+		{
+			continue;
+		}
+
+		const bool bInputLinked = KnotNode->GetInputPin()->LinkedTo.Num() > 0;
+		const bool bOutputLinked = KnotNode->GetOutputPin()->LinkedTo.Num() > 0;
+
+		// fully unlinked knots are reported by DetectKnotIssues
+		if (bInputLinked != bOutputLinked)
+		{
+			FBAGraphIssue& Issue = OutIssues.AddDefaulted_GetRef();
+			Issue.Type = EBAGraphIssueType::DanglingKnot;
+			Issue.Severity = EMessageSeverity::Warning;
+			Issue.Message = FString::Printf(TEXT("Reroute node is only linked on its %s %s"), bInputLinked ? TEXT("input") : TEXT("output"), *KnotNode->NodeGuid.ToString());
+			Issue.Node = KnotNode;
+		}
+	}
+}
+
+void FBAGraphHealth::DetectOverlappingNodes(UEdGraph* Graph, const FBAGraphData& GraphData, TArray<FBAGraphIssue>& OutIssues)
+{
+	struct FNodeBounds
+	{
+		UEdGraphNode* Node;
+		FSlateRect Bounds;
+	};
+
+	TArray<FNodeBounds> AllBounds;
+	AllBounds.Reserve(Graph->Nodes.Num());
+
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		// comments are meant to contain other nodes and knots sit on top of wires
+		if (!Node || FBAUtils::IsCommentNode(Node) || FBAUtils::IsKnotNode(Node))
+		{
+			continue;
+		}
+
+		FSlateRect Bounds;
+		if (BAGraphHealth::FindCachedBounds(GraphData, Node, Bounds))
+		{
+			AllBounds.Add({ Node, Bounds });
+		}
+	}
+
+	// sweep along x so each node is only tested against the nodes it overlaps horizontally
+	AllBounds.Sort([](const FNodeBounds& A, const FNodeBounds& B) { return A.Bounds.Left < B.Bounds.Left; });
+
+	for (int32 Index = 0; Index < AllBounds.Num(); ++Index)
+	{
+		const FNodeBounds& Current = AllBounds[Index];
+		for (int32 OtherIndex = Index + 1; OtherIndex < AllBounds.Num() && AllBounds[OtherIndex].Bounds.Left < Current.Bounds.Right; ++OtherIndex)
+		{
+			const FNodeBounds& Other = AllBounds[OtherIndex];
+			if (Other.Bounds.Top < Current.Bounds.Bottom && Current.Bounds.Top < Other.Bounds.Bottom)
+			{
+				FBAGraphIssue& Issue = OutIssues.AddDefaulted_GetRef();
+				Issue.Type = EBAGraphIssueType::OverlappingNodes;
+				Issue.Severity = EMessageSeverity::Warning;
+				Issue.Message = FString::Printf(TEXT("Node %s overlaps %s"), *FBAUtils::GetNodeName(Current.Node), *FBAUtils::GetNodeName(Other.Node));
+				Issue.Node = Current.Node;
+			}
+		}
+	}
+}
+
+void FBAGraphHealth::DetectUnformattedGraph(UEdGraph* Graph, const FBAGraphData& GraphData, TArray<FBAGraphIssue>& OutIssues)
+{
+	int32 NumBackwardLinks = 0;
+	UEdGraphNode* FirstNode = nullptr;
+
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (!Node || FBAUtils::IsKnotNode(Node))
+		{
+			continue;
+		}
+
+		FSlateRect Bounds;
+		const float NodeRight = BAGraphHealth::FindCachedBounds(GraphData, Node, Bounds) ? Bounds.Right : Node->NodePosX;
+
+		for (UEdGraphPin* Pin : FBAUtils::GetLinkedPins(Node, EGPD_Output).FilterByPredicate(FBAUtils::IsExecPin))
+		{
+			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
+				if (!FBAUtils::IsKnotNode(LinkedNode) && LinkedNode->NodePosX < NodeRight)
+				{
+					++NumBackwardLinks;
+					FirstNode = FirstNode ? FirstNode : Node;
+				}
+			}
+		}
+	}
+
+	if (NumBackwardLinks > 0)
+	{
+		FBAGraphIssue& Issue = OutIssues.AddDefaulted_GetRef();
+		Issue.Type = EBAGraphIssueType::UnformattedGraph;
+		Issue.Severity = EMessageSeverity::Info;
+		Issue.Message = FString::Printf(TEXT("Graph %s has %d exec links flowing right to left and may need formatting"), *FBAUtils::GetGraphName(Graph), NumBackwardLinks);
+		Issue.Node = FirstNode;
+	}
+}
+
+FString FBAGraphHealth::IssueTypeToString(EBAGraphIssueType Type)
+{
+	switch (Type)
+	{
+		case EBAGraphIssueType::UnlinkedKnot:
+			return TEXT("UnlinkedKnot");
+		case EBAGraphIssueType::BadlyLinkedKnot:
+			return TEXT("BadlyLinkedKnot");
+		case EBAGraphIssueType::DanglingKnot:
+			return TEXT("DanglingKnot");
+		case EBAGraphIssueType::OverlappingNodes:
+			return TEXT("OverlappingNodes");
+		case EBAGraphIssueType::UnformattedGraph:
+			return TEXT("UnformattedGraph");
+	}
+
+	return TEXT("Unknown");
+}
@@ -185,6 +185,11 @@ void UBAAssetEditorHandlerObject::CheckInvalidAssetEditors()
 	}
 }
 
+UBABlueprintHandlerObject* UBAAssetEditorHandlerObject::GetBlueprintHandler(const UBlueprint* Blueprint) const
+{
+	return Blueprint ? BlueprintHandlers.FindRef(Blueprint->GetBlueprintGuid()) : nullptr;
+}
+
 TSharedPtr<SDockTab> UBAAssetEditorHandlerObject::GetTabForAsset(UObject* Asset) const
 {
 	if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
@@ -5,11 +5,11 @@
 #include "BlueprintAssistGlobals.h"
 #include "BlueprintAssistSettings.h"
 #include "BlueprintAssistUtils.h"
+#include "BlueprintAssistMisc/BAGraphHealth.h"
 #include "Editor.h"
 #include "Engine/Blueprint.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_FunctionEntry.h"
-#include "K2Node_Knot.h"
 #include "K2Node_Tunnel.h"
 #include "ScopedTransaction.h"
 #include "SGraphActionMenu.h"
@@ -46,6 +46,7 @@ void UBABlueprintHandlerObject::BindBlueprintChanged(UBlueprint* Blueprint)
 	}
 
 	BlueprintPtr = TWeakObjectPtr<UBlueprint>(Blueprint);
+	SymbolIndex.Init(Blueprint);
 	SetLastVariables(Blueprint);
 	SetLastFunctionGraphs(Blueprint);
 	bProcessedChangesThisFrame = false;
@@ -67,6 +68,7 @@ void UBABlueprintHandlerObject::BindBlueprintChanged(UBlueprint* Blueprint)
 void UBABlueprintHandlerObject::UnbindBlueprintChanged(UBlueprint* Blueprint)
 {
 	LastVariables.Empty();
+	SymbolIndex.Reset();
 	bProcessedChangesThisFrame = false;
 	bActive = false;
 
@@ -88,7 +90,14 @@ void UBABlueprintHandlerObject::SetLastVariables(UBlueprint* Blueprint)
 		return;
 	}
 
-	LastVariables = Blueprint->NewVariables;
+	LastVariables.Empty(Blueprint->NewVariables.Num());
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		FBAVariableSnapshot& Snapshot = LastVariables.Add(Variable.VarGuid);
+		Snapshot.Description = Variable;
+		Snapshot.Hash = GetVariableHash(Variable);
+		Snapshot.LastSeenChange = ChangeCounter;
+	}
 }
 
 void UBABlueprintHandlerObject::SetLastFunctionGraphs(UBlueprint* Blueprint)
@@ -105,8 +114,7 @@ void UBABlueprintHandlerObject::SetLastFunctionGraphs(UBlueprint* Blueprint)
 	{
 		if (Graph && Graph->IsValidLowLevelFast(false))
 		{
-			TWeakObjectPtr<UEdGraph> WeakGraph(Graph);
-			LastFunctionGraphs.Add(WeakGraph);
+			LastFunctionGraphs.Add(TWeakObjectPtr<UEdGraph>(Graph));
 		}
 		else
 		{
@@ -142,6 +150,9 @@ void UBABlueprintHandlerObject::OnBlueprintChanged(UBlueprint* Blueprint)
 		return;
 	}
 
+	// graphs can change more than once per frame, so refresh the symbols before skipping processed changes
+	SymbolIndex.MarkGraphsDirty();
+
 	if (bProcessedChangesThisFrame)
 	{
 		return;
@@ -153,22 +164,34 @@ void UBABlueprintHandlerObject::OnBlueprintChanged(UBlueprint* Blueprint)
 	// This shouldn't happen!
 	check(Blueprint->IsValidLowLevelFast(false));
 
-	TMap<FGuid, int32> OldVariablesByGuid;
-	for (int32 VarIndex = 0; VarIndex < LastVariables.Num(); VarIndex++)
-	{
-		OldVariablesByGuid.Add(LastVariables[VarIndex].VarGuid, VarIndex);
-	}
+	// snapshots are only copied for variables whose hash changed, the blueprint can have hundreds of variables
+	// and this runs for every property edit in the details panel
+	++ChangeCounter;
 
 	for (FBPVariableDescription& NewVariable : Blueprint->NewVariables)
 	{
-		if (!OldVariablesByGuid.Contains(NewVariable.VarGuid))
+		FBAVariableSnapshot* Snapshot = LastVariables.Find(NewVariable.VarGuid);
+		if (!Snapshot)
 		{
 			OnVariableAdded(Blueprint, NewVariable);
+
+			// take the snapshot after applying the variable defaults
+			FBAVariableSnapshot& NewSnapshot = LastVariables.Add(NewVariable.VarGuid);
+			NewSnapshot.Description = NewVariable;
+			NewSnapshot.Hash = GetVariableHash(NewVariable);
+			NewSnapshot.LastSeenChange = ChangeCounter;
 			continue;
 		}
 
-		const int32 OldVarIndex = OldVariablesByGuid.FindChecked(NewVariable.VarGuid);
-		const FBPVariableDescription& OldVariable = LastVariables[OldVarIndex];
+		Snapshot->LastSeenChange = ChangeCounter;
+
+		// different hashes always mean a change, equal ones are confirmed against the snapshot
+		if (Snapshot->Hash == GetVariableHash(NewVariable) && !HasVariableChanged(Snapshot->Description, NewVariable))
+		{
+			continue;
+		}
+
+		const FBPVariableDescription& OldVariable = Snapshot->Description;
 
 		// Make set instance editable to true when you set expose on spawn to true
 		if (FBAUtils::HasMetaDataChanged(OldVariable, NewVariable, FBlueprintMetadata::MD_ExposeOnSpawn))
@@ -191,20 +214,78 @@ void UBABlueprintHandlerObject::OnBlueprintChanged(UBlueprint* Blueprint)
 		{
 			OnVariableTypeChanged(Blueprint, OldVariable, NewVariable);
 		}
+
+		Snapshot->Description = NewVariable;
+		Snapshot->Hash = GetVariableHash(NewVariable);
 	}
 
-	SetLastVariables(Blueprint);
+	// every variable still in the blueprint was stamped above, the others were removed. The counts can match even
+	// then (a variable removed and another added in the same change) so always sweep
+	for (auto It = LastVariables.CreateIterator(); It; ++It)
+	{
+		if (It.Value().LastSeenChange != ChangeCounter)
+		{
+			It.RemoveCurrent();
+		}
+	}
 
 	for (UEdGraph* FunctionGraph : Blueprint->FunctionGraphs)
 	{
 		// This means we created a new function?
-		if (!LastFunctionGraphs.Contains(FunctionGraph))
+		if (FunctionGraph && !LastFunctionGraphs.Contains(FunctionGraph))
 		{
 			OnFunctionAdded(Blueprint, FunctionGraph);
+			LastFunctionGraphs.Add(FunctionGraph);
 		}
 	}
 
-	SetLastFunctionGraphs(Blueprint);
+	// functions were removed, drop their stale entries
+	if (LastFunctionGraphs.Num() != Blueprint->FunctionGraphs.Num())
+	{
+		SetLastFunctionGraphs(Blueprint);
+	}
+}
+
+uint32 UBABlueprintHandlerObject::GetVariableHash(const FBPVariableDescription& Variable)
+{
+	// the display index keeps the case of the name, renames that only change the case still need to be detected
+#if WITH_CASE_PRESERVING_NAME
+	uint32 Hash = GetTypeHash(Variable.VarName.GetDisplayIndex());
+#else
+	uint32 Hash = GetTypeHash(Variable.VarName);
+#endif
+
+	const FEdGraphPinType& VarType = Variable.VarType;
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinCategory));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinSubCategory));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinSubCategoryObject.Get()));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(VarType.ContainerType)));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinValueType.TerminalCategory));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinValueType.TerminalSubCategory));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinValueType.TerminalSubCategoryObject.Get()));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinSubCategoryMemberReference.MemberParent));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinSubCategoryMemberReference.MemberName));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.PinSubCategoryMemberReference.MemberGuid));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.bIsReference));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.bIsConst));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.bIsWeakPointer));
+	Hash = HashCombine(Hash, GetTypeHash(VarType.bIsUObjectWrapper));
+
+	const int32 ExposeOnSpawnIndex = Variable.FindMetaDataEntryIndexForKey(FBlueprintMetadata::MD_ExposeOnSpawn);
+	if (ExposeOnSpawnIndex != INDEX_NONE)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Variable.MetaDataArray[ExposeOnSpawnIndex].DataValue));
+	}
+
+	return Hash;
+}
+
+bool UBABlueprintHandlerObject::HasVariableChanged(const FBPVariableDescription& OldVariable, const FBPVariableDescription& NewVariable)
+{
+	// names are compared as strings since FName comparison ignores case
+	return !OldVariable.VarName.ToString().Equals(NewVariable.VarName.ToString())
+		|| OldVariable.VarType != NewVariable.VarType
+		|| FBAUtils::HasMetaDataChanged(OldVariable, NewVariable, FBlueprintMetadata::MD_ExposeOnSpawn);
 }
 
 void UBABlueprintHandlerObject::ResetProcessedChangesThisFrame()
@@ -526,7 +607,7 @@ void UBABlueprintHandlerObject::DetectGraphIssues(UEdGraph* Graph)
 
 	struct FLocal
 	{
-		static void FocusNode(TWeakObjectPtr<UK2Node_Knot> Node)
+		static void FocusNode(TWeakObjectPtr<UEdGraphNode> Node)
 		{
 			if (Node.IsValid())
 			{
@@ -535,54 +616,33 @@ void UBABlueprintHandlerObject::DetectGraphIssues(UEdGraph* Graph)
 		}
 	};
 
+	TArray<FBAGraphIssue> Issues;
+	FBAGraphHealth::DetectKnotIssues(Graph, Issues);
+
+	if (Issues.Num() == 0)
+	{
+		return;
+	}
+
 	FMessageLog BlueprintAssistLog("BlueprintAssist");
 
-	for (UEdGraphNode* Node : Graph->Nodes)
+	bool bOpenMessageLog = false;
+	for (const FBAGraphIssue& Issue : Issues)
 	{
-		// Detect bad knot nodes
-		if (UK2Node_Knot* KnotNode = Cast<UK2Node_Knot>(Node))
-		{
-			// Detect empty knot nodes to be deleted
-			if (FBAUtils::GetLinkedPins(KnotNode).Num() == 0)
-			{
-				TSharedRef<FTokenizedMessage> Message = FTokenizedMessage::Create(EMessageSeverity::Info);
-				const FText MessageText = FText::FromString(FString::Printf(TEXT("Unlinked reroute node %s"), *KnotNode->NodeGuid.ToString()));
-				Message->AddToken(FTextToken::Create(MessageText));
-				Message->AddToken(FActionToken::Create(
-					FText::FromString("GoTo"),
-					FText::FromString("Go to node"),
-					FOnActionTokenExecuted::CreateStatic(&FLocal::FocusNode, TWeakObjectPtr<UK2Node_Knot>(KnotNode))));
-
-				BlueprintAssistLog.AddMessage(Message);
-			}
-			else
-			{
-				bool bOpenMessageLog = false;
+		TSharedRef<FTokenizedMessage> Message = FTokenizedMessage::Create(Issue.Severity);
+		Message->AddToken(FTextToken::Create(FText::FromString(Issue.Message)));
+		Message->AddToken(FActionToken::Create(
+			FText::FromString("GoTo"),
+			FText::FromString("Go to node"),
+			FOnActionTokenExecuted::CreateStatic(&FLocal::FocusNode, Issue.Node)));
 
-				// Detect badly linked exec knot nodes
-				for (UEdGraphPin* Pin : FBAUtils::GetLinkedPins(KnotNode, EGPD_Output).FilterByPredicate(FBAUtils::IsExecPin))
-				{
-					if (Pin->LinkedTo.Num() > 1)
-					{
-						TSharedRef<FTokenizedMessage> Message = FTokenizedMessage::Create(EMessageSeverity::Error);
-						const FText MessageText = FText::FromString(FString::Printf(TEXT("Badly linked reroute node (manually delete and remake this node) %s"), *KnotNode->NodeGuid.ToString()));
-						Message->AddToken(FTextToken::Create(MessageText));
-						Message->AddToken(FActionToken::Create(
-							FText::FromString("GoTo"),
-							FText::FromString("Go to node"),
-							FOnActionTokenExecuted::CreateStatic(&FLocal::FocusNode, TWeakObjectPtr<UK2Node_Knot>(KnotNode))));
-
-						BlueprintAssistLog.AddMessage(Message);
-
-						bOpenMessageLog = true;
-					}
-				}
+		BlueprintAssistLog.AddMessage(Message);
 
-				if (bOpenMessageLog)
-				{
-					BlueprintAssistLog.Open();
-				}
-			}
-		}
+		bOpenMessageLog |= Issue.Severity == EMessageSeverity::Error;
+	}
+
+	if (bOpenMessageLog)
+	{
+		BlueprintAssistLog.Open();
 	}
 }
@@ -254,9 +254,7 @@ UBASettings::UBASettings(const FObjectInitializer& ObjectInitializer)
 	bAddKnotNodesToComments = true;
 	CommentNodePadding = FIntPoint(30, 30);
 
-	bEnableFasterFormatting = false;
-
-	bUseKnotNodePool = false;
+	bUseKnotNodePool = true;
 
 	bSlowButAccurateSizeCaching = false;
 
@@ -29,6 +29,7 @@
 #include "SCommentBubble.h"
 #include "SGraphActionMenu.h"
 #include "BlueprintAssistObjects/BARootObject.h"
+#include "BlueprintAssistFormatters/BAFormatGeometry.h"
 #include "BlueprintAssistFormatters/BlueprintAssistCommentHandler.h"
 #include "BlueprintAssistFormatters/GraphFormatterTypes.h"
 #include "EdGraph/EdGraphSchema.h"
@@ -407,6 +408,11 @@ FVector2D FBAUtils::GetPinPos(TSharedPtr<FBAGraphHandler> GraphHandler, UEdGraph
 {
 	if (Pin)
 	{
+		if (FBAFormatGeometry* FormatGeometry = GraphHandler->GetFormatGeometry())
+		{
+			return FormatGeometry->GetPinPos(Pin);
+		}
+
 		UEdGraphNode* OwningNode = Pin->GetOwningNode();
 
 		const FSlateRect NodeBounds = GetCachedNodeBounds(GraphHandler, OwningNode, false);
@@ -532,7 +538,8 @@ UK2Node_Knot* FBAUtils::CreateKnotNode(
 	UEdGraph* Graph,
 	const FVector2D& Position,
 	UEdGraphPin* PinA,
-	UEdGraphPin* PinB)
+	UEdGraphPin* PinB,
+	bool bNotifyGraph)
 {
 	if (!Graph)
 	{
@@ -545,7 +552,15 @@ UK2Node_Knot* FBAUtils::CreateKnotNode(
 		NewKnot->SetFlags(RF_Transactional);
 	}
 
-	Graph->AddNode(NewKnot, false, false);
+	if (bNotifyGraph)
+	{
+		Graph->AddNode(NewKnot, false, false);
+	}
+	else
+	{
+		// same as AddNode without the graph changed broadcast
+		Graph->Nodes.Add(NewKnot);
+	}
 	NewKnot->CreateNewGuid();
 	NewKnot->PostPlacedNewNode();
 	NewKnot->AllocateDefaultPins();
@@ -3433,7 +3448,7 @@ bool FBAUtils::HasMetaDataChanged(const FBPVariableDescription& OldVariable, con
 {
 	if (OldVariable.HasMetaData(Key) && NewVariable.HasMetaData(Key))
 	{
-		return !OldVariable.GetMetaData(Key).Compare(NewVariable.GetMetaData(Key));
+		return OldVariable.GetMetaData(Key).Compare(NewVariable.GetMetaData(Key)) != 0;
 	}
 
 	return OldVariable.HasMetaData(Key) != NewVariable.HasMetaData(Key);
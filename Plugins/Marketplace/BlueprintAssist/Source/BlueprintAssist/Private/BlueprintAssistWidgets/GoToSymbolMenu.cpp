@@ -5,9 +5,10 @@
 #include "BlueprintAssistGraphHandler.h"
 #include "BlueprintAssistUtils.h"
 #include "BlueprintEditor.h"
-#include "K2Node_CustomEvent.h"
-#include "K2Node_Event.h"
+#include "BlueprintAssistMisc/BABlueprintSymbolIndex.h"
 #include "BlueprintAssistMisc/BAMiscUtils.h"
+#include "BlueprintAssistObjects/BAAssetEditorHandlerObject.h"
+#include "BlueprintAssistObjects/BABlueprintHandlerObject.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -34,53 +35,27 @@ void SGoToSymbolMenu::InitListItems(TArray<TSharedPtr<FGoToSymbolStruct>>& Items
 	UBlueprint* Blueprint = FBAMiscUtils::GetAssetForActiveTab<UBlueprint>();
 	check(Blueprint)
 
-	TArray<UEdGraph*> BlueprintGraphs;
-	Blueprint->GetAllGraphs(BlueprintGraphs);
-
 	Items.Empty();
 
-	for (UEdGraph* Graph : BlueprintGraphs)
-	{
-		const EGraphType GraphType = FBAUtils::GetGraphType(Graph);
-
-		if (Blueprint->DelegateSignatureGraphs.Contains(Graph))
-		{
-			continue;
-		}
-
-		// add all event nodes on the graph for ubergraphs
-		if (GraphType == GT_Ubergraph)
-		{
-			TArray<UEdGraphNode*> EventNodes;
-			Graph->GetNodesOfClass(EventNodes);
-
-			EventNodes = EventNodes.FilterByPredicate(
-				[](UEdGraphNode* Node)
-				{
-					return Node->GetClass()->ImplementsInterface(UK2Node_EventNodeInterface::StaticClass());
-				});
-
-			EventNodes.Sort([](const UEdGraphNode& NodeA, const UEdGraphNode& NodeB)
-			{
-				const bool bIsEventA = NodeA.GetClass() == UK2Node_Event::StaticClass();
-				const bool bIsEventB = NodeB.GetClass() == UK2Node_Event::StaticClass();
-				if (bIsEventA != bIsEventB) return bIsEventA > bIsEventB;
-
-				const bool bIsCustomEventA = NodeA.GetClass() == UK2Node_CustomEvent::StaticClass();
-				const bool bIsCustomEventB = NodeB.GetClass() == UK2Node_CustomEvent::StaticClass();
-				if (bIsCustomEventA != bIsCustomEventB) return bIsCustomEventA > bIsCustomEventB;
-
-				return true;
-			});
+	TArray<FBABlueprintSymbol> Symbols;
 
-			for (UEdGraphNode* Node : EventNodes)
-			{
-				Items.Add(MakeShareable(new FGoToSymbolStruct(Node, Graph)));
-			}
-		}
+	// the blueprint handler keeps the symbols up to date while the blueprint is open
+	UBAAssetEditorHandlerObject* AssetHandler = UBAAssetEditorHandlerObject::Get();
+	if (UBABlueprintHandlerObject* BlueprintHandler = AssetHandler ? AssetHandler->GetBlueprintHandler(Blueprint) : nullptr)
+	{
+		BlueprintHandler->GetSymbolIndex().GetSymbols(Symbols);
+	}
+	else
+	{
+		FBABlueprintSymbolIndex SymbolIndex;
+		SymbolIndex.Init(Blueprint);
+		SymbolIndex.GetSymbols(Symbols);
+	}
 
-		// add the graph itself
-		Items.Add(MakeShareable(new FGoToSymbolStruct(nullptr, Graph)));
+	Items.Reserve(Symbols.Num());
+	for (const FBABlueprintSymbol& Symbol : Symbols)
+	{
+		Items.Add(MakeShareable(new FGoToSymbolStruct(Symbol.EventNode, Symbol.Graph)));
 	}
 }
 
@@ -0,0 +1,81 @@
+// Copyright fpwong. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FBAGraphHandler;
+class UEdGraphNode;
+class UEdGraphPin;
+
+/**
+ * Flat snapshot of node sizes and pin offsets for a single synchronous format pass.
+ * Every node and pin gets a dense id the first time it is queried, so the hot formatter loops
+ * index into contiguous arrays instead of going through the package -> graph -> node -> pin maps of FBACache.
+ * Positions are always read from the node itself, so nodes moved by the formatter stay correct.
+ *
+ * The node and pin overloads resolve their id with one pointer lookup, then read the arrays the same way as the id overloads.
+ * The formatters only hold node and pin pointers and the graph can change between passes, so ids are never stored outside the snapshot.
+ */
+class BLUEPRINTASSIST_API FBAFormatGeometry
+{
+public:
+	static constexpr int32 InvalidId = INDEX_NONE;
+
+	void Init(TSharedPtr<FBAGraphHandler> InGraphHandler);
+
+	void Reset();
+
+	/** Assigns the next dense id on first query, InvalidId for null nodes */
+	int32 GetNodeId(UEdGraphNode* Node);
+
+	/** Assigns the next dense id on first query, also registering the owning node */
+	int32 GetPinId(const UEdGraphPin* Pin);
+
+	UEdGraphNode* GetNode(int32 NodeId) const { return Nodes[NodeId]; }
+
+	FSlateRect GetNodeBounds(int32 NodeId, bool bWithCommentBubble = true) const;
+
+	FSlateRect GetNodeBounds(UEdGraphNode* Node, bool bWithCommentBubble = true);
+
+	int32 GetPinY(int32 PinId) const;
+
+	int32 GetPinY(const UEdGraphPin* Pin);
+
+	FVector2D GetPinPos(int32 PinId) const;
+
+	FVector2D GetPinPos(const UEdGraphPin* Pin);
+
+	int32 NumNodes() const { return Nodes.Num(); }
+
+	int32 NumPins() const { return Pins.Num(); }
+
+private:
+	TWeakPtr<FBAGraphHandler> GraphHandler;
+
+	TMap<const UEdGraphNode*, int32> NodeIds;
+	TMap<const UEdGraphPin*, int32> PinIds;
+
+	// indexed by node id
+	TArray<UEdGraphNode*> Nodes;
+	TArray<FIntPoint> NodeSizes;
+	TArray<FIntPoint> CommentBubbleSizes;
+
+	// indexed by pin id
+	TArray<const UEdGraphPin*> Pins;
+	TArray<FGuid> PinGuids;
+	TArray<int32> PinNodeIds;
+	TArray<float> PinOffsets;
+};
+
+/**
+ * Keeps the graph handler's format geometry alive for the current scope, nested scopes share the outermost snapshot
+ */
+struct BLUEPRINTASSIST_API FBAFormatGeometryScope
+{
+	FBAFormatGeometryScope(TSharedPtr<FBAGraphHandler> InGraphHandler);
+	~FBAFormatGeometryScope();
+
+private:
+	TSharedPtr<FBAGraphHandler> GraphHandler;
+};
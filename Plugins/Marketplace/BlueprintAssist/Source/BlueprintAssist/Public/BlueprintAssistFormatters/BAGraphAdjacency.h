@@ -0,0 +1,133 @@
+// Copyright fpwong. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+
+class UEdGraphNode;
+
+enum class EBALinkKind : uint8
+{
+	Exec,
+	Parameter,
+	Delegate,
+	Num
+};
+
+enum class EBALinkKindMask : uint8
+{
+	None = 0,
+	Exec = 1 << static_cast<uint8>(EBALinkKind::Exec),
+	Parameter = 1 << static_cast<uint8>(EBALinkKind::Parameter),
+	Delegate = 1 << static_cast<uint8>(EBALinkKind::Delegate),
+	ExecOrDelegate = Exec | Delegate,
+	All = Exec | Parameter | Delegate,
+};
+
+ENUM_CLASS_FLAGS(EBALinkKindMask);
+
+struct FBAAdjacencyLink
+{
+	UEdGraphPin* From = nullptr;
+	UEdGraphPin* To = nullptr;
+	int32 ToNodeId = INDEX_NONE;
+};
+
+/**
+ * Compressed (CSR) adjacency of the nodes connected to a root node, built once per format pass.
+ * Links of every node are bucketed by pin direction and kind (exec / parameter / delegate, decided by the pin the link starts from)
+ * and stored contiguously, so traversals are index walks with no per-node pin filtering or temporary arrays.
+ * Only valid while the links of the graph don't change, rebuild after creating or removing knot nodes.
+ */
+class BLUEPRINTASSIST_API FBAGraphAdjacency
+{
+public:
+	void Build(UEdGraphNode* RootNode);
+
+	void Reset();
+
+	bool IsBuilt() const { return Nodes.Num() > 0; }
+
+	int32 Num() const { return Nodes.Num(); }
+
+	int32 GetNodeId(const UEdGraphNode* Node) const
+	{
+		const int32* FoundId = NodeIds.Find(Node);
+		return FoundId ? *FoundId : INDEX_NONE;
+	}
+
+	UEdGraphNode* GetNode(int32 NodeId) const { return Nodes[NodeId]; }
+
+	TConstArrayView<FBAAdjacencyLink> GetLinks(int32 NodeId, EEdGraphPinDirection Direction, EBALinkKind Kind) const
+	{
+		const int32 Bucket = GetBucketIndex(NodeId, Direction, Kind);
+		return TConstArrayView<FBAAdjacencyLink>(Links.GetData() + BucketOffsets[Bucket], BucketOffsets[Bucket + 1] - BucketOffsets[Bucket]);
+	}
+
+	/** Calls Func for every link of the node matching the direction (EGPD_MAX for both) and kind mask, outputs first */
+	template<typename FuncType>
+	void ForEachLink(int32 NodeId, EEdGraphPinDirection Direction, EBALinkKindMask Mask, FuncType Func) const
+	{
+		for (EEdGraphPinDirection Dir : { EGPD_Output, EGPD_Input })
+		{
+			if (Direction != EGPD_MAX && Direction != Dir)
+			{
+				continue;
+			}
+
+			for (uint8 Kind = 0; Kind < static_cast<uint8>(EBALinkKind::Num); ++Kind)
+			{
+				if (EnumHasAnyFlags(Mask, static_cast<EBALinkKindMask>(1 << Kind)))
+				{
+					for (const FBAAdjacencyLink& Link : GetLinks(NodeId, Dir, static_cast<EBALinkKind>(Kind)))
+					{
+						Func(Link);
+					}
+				}
+			}
+		}
+	}
+
+	/** Breadth first walk from the initial node, same as FBAUtils::GetNodeTree when using EBALinkKindMask::All */
+	void GetNodeTree(UEdGraphNode* InitialNode, TArray<UEdGraphNode*>& OutNodes, EBALinkKindMask Mask = EBALinkKindMask::All, EEdGraphPinDirection Direction = EGPD_MAX, bool bOnlyInitialDirection = false) const;
+
+	/** Same as FBAUtils::GetNodeTreeWithFilter, only links passing the filter are followed */
+	void GetNodeTreeWithFilter(UEdGraphNode* InitialNode, TArray<UEdGraphNode*>& OutNodes, TFunctionRef<bool(const FBAAdjacencyLink&)> LinkFilter, EEdGraphPinDirection Direction = EGPD_MAX, bool bOnlyInitialDirection = false) const;
+
+	/** Same as FBAUtils::GetExecTree */
+	void GetExecTree(UEdGraphNode* InitialNode, TArray<UEdGraphNode*>& OutNodes, EEdGraphPinDirection Direction = EGPD_MAX) const;
+
+	/** Whether Target is in the tree of InitialNode, stops as soon as it is found */
+	bool IsInTree(UEdGraphNode* InitialNode, const UEdGraphNode* Target, EBALinkKindMask Mask, EEdGraphPinDirection Direction = EGPD_MAX) const;
+
+	/** Unique nodes linked to the node, same as FBAUtils::GetLinkedNodes when using EBALinkKindMask::All */
+	void GetLinkedNodes(UEdGraphNode* Node, TArray<UEdGraphNode*>& OutNodes, EBALinkKindMask Mask = EBALinkKindMask::All, EEdGraphPinDirection Direction = EGPD_MAX) const;
+
+private:
+	static constexpr int32 NumBucketsPerNode = 2 * static_cast<int32>(EBALinkKind::Num);
+
+	static int32 GetBucketIndex(int32 NodeId, EEdGraphPinDirection Direction, EBALinkKind Kind)
+	{
+		return NodeId * NumBucketsPerNode + (Direction == EGPD_Output ? static_cast<int32>(EBALinkKind::Num) : 0) + static_cast<int32>(Kind);
+	}
+
+	static EBALinkKind GetLinkKind(const UEdGraphPin* Pin);
+
+	template<typename FuncType, typename FilterType>
+	bool WalkTree(int32 InitialId, EBALinkKindMask Mask, EEdGraphPinDirection Direction, bool bOnlyInitialDirection, FuncType Visit, FilterType LinkFilter) const;
+
+	uint32 BeginVisit() const;
+
+	TMap<const UEdGraphNode*, int32> NodeIds;
+	TArray<UEdGraphNode*> Nodes;
+
+	// NumBucketsPerNode entries per node (+1), indexing into Links
+	TArray<int32> BucketOffsets;
+	TArray<FBAAdjacencyLink> Links;
+
+	// traversal scratch, kept between walks so they don't allocate
+	mutable TArray<uint32> VisitStamps;
+	mutable uint32 CurrentStamp = 0;
+	mutable TArray<int32> WalkQueue;
+};
@@ -7,6 +7,7 @@
 #include "BlueprintAssistGraphHandler.h"
 #include "BlueprintAssistSettings.h"
 #include "FormatterInterface.h"
+#include "BlueprintAssistFormatters/BAGraphAdjacency.h"
 #include "BlueprintAssistFormatters/GraphFormatterTypes.h"
 #include "BlueprintAssistFormatters/KnotTrackCreator.h"
 #include "EdGraph/EdGraphNode.h"
@@ -23,7 +24,6 @@ struct FBACommentContainsNode;
 struct FNodeChangeInfo
 {
 	TWeakObjectPtr<UEdGraphNode> Node;
-	TSet<FPinLink> Links;
 	int32 NodeX;
 	int32 NodeY;
 
@@ -32,13 +32,28 @@ struct FNodeChangeInfo
 
 	FBANodeSizeChangeData NodeSizeChangeData;
 
-	TSet<FGuid> ContainingComments;
+	FNodeChangeInfo(UEdGraphNode* Node, UEdGraphNode* NodeToKeepStill);
 
-	FNodeChangeInfo(UEdGraphNode* Node, UEdGraphNode* NodeToKeepStill, FCommentHandler* CommentHandler);
+	void UpdateValues(UEdGraphNode* NodeToKeepStill);
 
-	void UpdateValues(UEdGraphNode* NodeToKeepStill, FCommentHandler* CommentHandler);
+	bool HasChanged();
+};
+
+struct FNodeTreeFingerprint
+{
+	FGuid RootNodeGuid;
+	int32 NumNodes = 0;
+	uint32 Hash = 0;
 
-	bool HasChanged(UEdGraphNode* NodeToKeepStill, FCommentHandler* CommentHandler);
+	bool operator==(const FNodeTreeFingerprint& Other) const
+	{
+		return Hash == Other.Hash && NumNodes == Other.NumNodes && RootNodeGuid == Other.RootNodeGuid;
+	}
+
+	bool operator!=(const FNodeTreeFingerprint& Other) const
+	{
+		return !(*this == Other);
+	}
 };
 
 struct ChildBranch
@@ -95,8 +110,14 @@ public:
 
 	virtual FEdGraphFormatterParameters& GetFormatterParameters() override { return FormatterParameters; }
 
+	/** The formatter is kept for its root, so an unchanged tree can replay the last layout instead of being formatted again */
+	void EnableLayoutReplay() { bCanReplayLayout = true; }
+
 	TSharedPtr<FEdGraphParameterFormatter> GetParameterFormatter(UEdGraphNode* Node);
 
+	/** Links of the root tree, shared by the parameter formatters. Only built while formatting, before the knot nodes are created */
+	FBAGraphAdjacency& GetAdjacency() { return Adjacency; }
+
 	virtual TSharedPtr<FFormatterInterface> GetChildFormatter(UEdGraphNode* Node) override;
 
 	virtual TArray<TSharedPtr<FFormatterInterface>> GetChildFormatters() override;
@@ -146,6 +167,11 @@ private:
 
 	TMap<UEdGraphNode*, FNodeChangeInfo> NodeChangeInfos;
 
+	/** Structural hash of the node tree when it was last formatted, see GetTreeFingerprint */
+	TOptional<FNodeTreeFingerprint> TreeFingerprint;
+
+	bool bCanReplayLayout = false;
+
 	TMap<UEdGraphNode*, TSharedPtr<FFormatXInfo>> FormatXInfoMap;
 
 	TSharedPtr<FEdGraphParameterFormatter> MainParameterFormatter;
@@ -159,6 +185,8 @@ private:
 
 	FFormatterConnectionValidator ConnectionValidator;
 
+	FBAGraphAdjacency Adjacency;
+
 	virtual UEdGraphNode* GetRootNode() override
 	{
 		check(RootNodeWeakPtr.IsValid());
@@ -169,6 +197,9 @@ private:
 
 	bool IsFormattingRequired(const TArray<UEdGraphNode*>& NewNodeTree);
 
+	/** Hash of the node set, links, cached sizes and containing comments of the tree */
+	FNodeTreeFingerprint GetTreeFingerprint(const TArray<UEdGraphNode*>& InNodeTree, TSharedPtr<FBACommentContainsGraph> ContainsGraph) const;
+
 	void SaveFormattingEndInfo();
 
 	TArray<UEdGraphNode*> GetNodeTree(UEdGraphNode* InitialNode) const;
@@ -24,7 +24,7 @@ class BLUEPRINTASSIST_API FEdGraphParameterFormatter final
 	TSharedPtr<FEdGraphFormatter> GraphFormatter;
 
 public:
-	TArray<UEdGraphNode*> IgnoredNodes;
+	TSet<UEdGraphNode*> IgnoredNodes;
 	TSet<UEdGraphNode*> FormattedInputNodes;
 	TSet<UEdGraphNode*> FormattedOutputNodes;
 	TSet<UEdGraphNode*> AllFormattedNodes;
@@ -56,7 +56,7 @@ public:
 
 	virtual TSet<UEdGraphNode*> GetFormattedNodes() override;
 
-	void SetIgnoredNodes(TArray<UEdGraphNode*> InIgnoredNodes) { IgnoredNodes = InIgnoredNodes; }
+	void SetIgnoredNodes(const TSet<UEdGraphNode*>& InIgnoredNodes) { IgnoredNodes = InIgnoredNodes; }
 
 	FSlateRect GetBounds();
 
@@ -87,6 +87,9 @@ private:
 
 	bool DoesHelixingApply();
 
+	/** Pure nodes linked to the input parameter pins of the node, read from the graph formatter's adjacency when it contains the node */
+	void GetLinkedPureInputNodes(UEdGraphNode* Node, TSet<UEdGraphNode*>& OutNodes) const;
+
 	UEdGraphNode* NodeToKeepStill;
 
 	FIntPoint Padding;
@@ -95,7 +98,7 @@ private:
 
 	TMap<UEdGraphNode*, FVector2D> NodeOffsets;
 
-	TArray<FPinLink> Path;
+	TSet<FPinLink> Path;
 
 	void ProcessSameRowMapping(UEdGraphNode* CurrentNode,
 								UEdGraphPin* CurrentPin,
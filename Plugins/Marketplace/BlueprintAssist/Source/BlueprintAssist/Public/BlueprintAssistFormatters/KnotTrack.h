@@ -48,7 +48,7 @@ struct BLUEPRINTASSIST_API FKnotNodeCreation
 	UEdGraphPin* GetPinToConnectTo();
 	TArray<UEdGraphPin*> GetPinsToConnectTo() const;
 
-	UK2Node_Knot* CreateKnotNode(FVector2D InKnotPos, UEdGraphPin* PreviousPin, UK2Node_Knot* KnotNodeToReuse, UEdGraph* Graph);
+	UK2Node_Knot* CreateKnotNode(FVector2D InKnotPos, UEdGraphPin* PreviousPin, UK2Node_Knot* KnotNodeToReuse, UEdGraph* Graph, bool bNotifyGraph = true);
 
 	bool HasHeightDifference() const;
 
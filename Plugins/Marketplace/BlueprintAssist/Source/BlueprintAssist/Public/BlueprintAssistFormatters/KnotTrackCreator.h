@@ -15,7 +15,8 @@ class FKnotTrackCreator final
 	TSharedPtr<FBAGraphHandler> GraphHandler;
 	TSet<UEdGraphNode*> KnotNodesSet;
 	TArray<TSharedPtr<FKnotNodeTrack>> KnotTracks;
-	TArray<UK2Node_Knot*> KnotNodePool;
+	TSet<UK2Node_Knot*> KnotNodePool;
+	TMap<const UEdGraphPin*, TArray<UK2Node_Knot*>> PooledKnotsByPin;
 	TMap<UK2Node_Knot*, UEdGraphNode*> KnotNodeOwners;
 	TSet<UK2Node_Knot*> PinAlignedKnots;
 	TSet<UK2Node_Knot*> KnotsInComments;
@@ -40,6 +41,9 @@ public:
 	const TSet<UEdGraphNode*>& GetCreatedKnotNodes() { return KnotNodesSet; }
 	void Reset();
 
+	/** Deletes the pooled knots which weren't reused, must be called on every path out of a format pass that removed knots */
+	void ReleaseKnotNodePool();
+
 	bool IsPinAlignedKnot(const UK2Node_Knot* KnotNode);
 	TSharedPtr<FGroupedTracks> GetKnotGroup(const UK2Node_Knot* KnotNode);
 
@@ -73,6 +77,8 @@ private:
 
 	UK2Node_Knot* CreateKnotNode(FKnotNodeCreation* Creation, const FVector2D& Position, UEdGraphPin* ParentPin);
 
+	UK2Node_Knot* TakeKnotNodeFromPool(FKnotNodeCreation* Creation, const FVector2D& Position);
+
 	void AddKnotNodesToComments();
 
 	void PrintKnotTracks();
@@ -7,6 +7,7 @@
 #include "BlueprintAssistNodeSizeChangeData.h"
 #include "BlueprintAssistFormatters/GraphFormatterTypes.h"
 
+class FBAFormatGeometry;
 class SBlueprintAssistGraphOverlay;
 class SMyBlueprint;
 class FBANodeSizeChangeData;
@@ -74,6 +75,9 @@ public:
 
 	int32 GetPinY(const UEdGraphPin* Pin);
 
+	/** Pin offset from the top of its node, from the cached node data or the pin widget. False if neither is available */
+	bool CalculatePinOffset(const UEdGraphPin* Pin, float& OutOffset);
+
 	void UpdateCachedNodeSize(float DeltaTime);
 
 	void UpdateNodesRequiringFormatting();
@@ -119,6 +123,35 @@ public:
 
 	FSlateRect GetCachedNodeBounds(UEdGraphNode* Node, bool bWithCommentBubble = true);
 
+	FIntPoint CalculateNodeSize(UEdGraphNode* Node);
+
+	FIntPoint GetCommentBubbleSize(UEdGraphNode* Node);
+
+	/** Snapshot of node bounds and pin offsets, only valid while a format pass is running (see FBAFormatGeometryScope) */
+	FBAFormatGeometry* GetFormatGeometry() const { return FormatGeometry.Get(); }
+
+	void BeginFormatGeometry();
+
+	void EndFormatGeometry();
+
+	/**
+	 * Save the node for undo before moving it. While a node move batch is active (see FBANodeMoveBatchScope)
+	 * this only remembers the original position, the node is saved when the batch ends and only if it actually moved
+	 */
+	void ModifyNodeForMove(UEdGraphNode* Node);
+
+	/** Save the batched nodes which have moved so far, must be called before the formatter edits links as that saves the node as it is now */
+	void FlushNodeMoves();
+
+	void BeginNodeMoveBatch();
+
+	void EndNodeMoveBatch();
+
+	bool IsNodeMoveBatchActive() const { return NodeMoveBatchCount > 0; }
+
+	/** The node was added without notifying the graph, a single add node broadcast is sent for all of them when the batch ends */
+	void AddNodeAddedDuringNodeMoveBatch(UEdGraphNode* Node);
+
 	UEdGraphPin* GetSelectedPin();
 
 	TSharedPtr<SGraphNode> GetGraphNode(UEdGraphNode* Node);
@@ -231,6 +264,14 @@ private:
 	TSharedPtr<FScopedTransaction> ReplaceNewNodeTransaction;
 	TSharedPtr<FScopedTransaction> FormatAllTransaction;
 
+	TSharedPtr<FBAFormatGeometry> FormatGeometry;
+	int32 FormatGeometryScopeCount = 0;
+
+	int32 NodeMoveBatchCount = 0;
+	TMap<UEdGraphNode*, FIntPoint> PendingNodeMoves;
+	bool bGraphChangedDuringNodeMoveBatch = false;
+	TArray<TWeakObjectPtr<UEdGraphNode>> NodesAddedDuringNodeMoveBatch;
+
 	TArray<TWeakObjectPtr<UEdGraphNode>> LastNodes;
 
 	FDelegateHandle OnGraphChangedHandle;
@@ -293,3 +334,15 @@ private:
 
 	void OnDelayedCacheSizeFinished();
 };
+
+/**
+ * Batches the undo records of node moves for the current scope, nested scopes share the outermost batch
+ */
+struct BLUEPRINTASSIST_API FBANodeMoveBatchScope
+{
+	FBANodeMoveBatchScope(TSharedPtr<FBAGraphHandler> InGraphHandler);
+	~FBANodeMoveBatchScope();
+
+private:
+	TSharedPtr<FBAGraphHandler> GraphHandler;
+};
@@ -0,0 +1,67 @@
+// Copyright fpwong. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+struct FBABlueprintSymbol
+{
+	UEdGraphNode* EventNode = nullptr;
+	UEdGraph* Graph = nullptr;
+};
+
+/**
+ * Graphs of a blueprint and the event nodes of its ubergraphs, in the order shown by the go to symbol menu.
+ * The graph list is refreshed after the blueprint changes and event nodes are added or removed from the graph changed events,
+ * so opening the menu doesn't have to scan every node of the event graphs.
+ */
+class BLUEPRINTASSIST_API FBABlueprintSymbolIndex
+{
+public:
+	~FBABlueprintSymbolIndex();
+
+	void Init(UBlueprint* InBlueprint);
+
+	void Reset();
+
+	/** Called when the blueprint changed, graphs may have been added, removed or renamed */
+	void MarkGraphsDirty() { bGraphsDirty = true; }
+
+	void GetSymbols(TArray<FBABlueprintSymbol>& OutSymbols);
+
+private:
+	struct FGraphEntry
+	{
+		TWeakObjectPtr<UEdGraph> Graph;
+		TArray<TWeakObjectPtr<UEdGraphNode>> EventNodes;
+		FDelegateHandle OnGraphChangedHandle;
+		bool bIsUbergraph = false;
+		bool bEventNodesDirty = true;
+	};
+
+	void UpdateGraphs();
+
+	void UpdateEventNodes(FGraphEntry& Entry);
+
+	void UnbindGraph(FGraphEntry& Entry);
+
+	void OnGraphChanged(const FEdGraphEditAction& Action, TWeakObjectPtr<UEdGraph> Graph);
+
+	FGraphEntry* FindEntry(const UEdGraph* Graph);
+
+	static bool IsSymbolEventNode(const UEdGraphNode* Node);
+
+	/** Event nodes are listed first, then custom events, then any other event node (input actions, component events...) */
+	static int32 GetEventNodeOrder(const UEdGraphNode* Node);
+
+	TWeakObjectPtr<UBlueprint> Blueprint;
+
+	TArray<FGraphEntry> Graphs;
+
+	bool bGraphsDirty = true;
+};
@@ -0,0 +1,49 @@
+// Copyright fpwong. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/TokenizedMessage.h"
+
+class UEdGraph;
+class UEdGraphNode;
+struct FBAGraphData;
+
+enum class EBAGraphIssueType : uint8
+{
+	UnlinkedKnot,
+	BadlyLinkedKnot,
+	DanglingKnot,
+	OverlappingNodes,
+	UnformattedGraph,
+};
+
+struct FBAGraphIssue
+{
+	EBAGraphIssueType Type = EBAGraphIssueType::UnlinkedKnot;
+	EMessageSeverity::Type Severity = EMessageSeverity::Info;
+	FString Message;
+	TWeakObjectPtr<UEdGraphNode> Node;
+};
+
+/**
+ * Graph checks shared by the compile time message log (UBABlueprintHandlerObject::DetectGraphIssues)
+ * and the project wide scan (UBAGraphHealthCommandlet)
+ */
+class BLUEPRINTASSIST_API FBAGraphHealth
+{
+public:
+	/** Reroute nodes with no links or exec outputs linked to more than one pin */
+	static void DetectKnotIssues(UEdGraph* Graph, TArray<FBAGraphIssue>& OutIssues);
+
+	/** Reroute nodes only linked on one side, they don't carry anything */
+	static void DetectDanglingKnots(UEdGraph* Graph, TArray<FBAGraphIssue>& OutIssues);
+
+	/** Nodes whose cached bounds overlap, nodes without a cached size are skipped */
+	static void DetectOverlappingNodes(UEdGraph* Graph, const FBAGraphData& GraphData, TArray<FBAGraphIssue>& OutIssues);
+
+	/** Exec links flowing right to left, which the formatter never produces outside of loops */
+	static void DetectUnformattedGraph(UEdGraph* Graph, const FBAGraphData& GraphData, TArray<FBAGraphIssue>& OutIssues);
+
+	static FString IssueTypeToString(EBAGraphIssueType Type);
+};
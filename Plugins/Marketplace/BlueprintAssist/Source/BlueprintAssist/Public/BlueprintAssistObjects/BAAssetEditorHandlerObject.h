@@ -11,6 +11,7 @@
 
 class IAssetEditorInstance;
 class UBABlueprintHandlerObject;
+class UBlueprint;
 
 UCLASS()
 class BLUEPRINTASSIST_API UBAAssetEditorHandlerObject : public UObject
@@ -65,6 +66,8 @@ public:
 
 	TSharedPtr<SDockTab> GetTabForAssetEditor(IAssetEditorInstance* AssetEditor) const;
 
+	UBABlueprintHandlerObject* GetBlueprintHandler(const UBlueprint* Blueprint) const;
+
 protected:
 	void BindAssetOpenedDelegate();
 
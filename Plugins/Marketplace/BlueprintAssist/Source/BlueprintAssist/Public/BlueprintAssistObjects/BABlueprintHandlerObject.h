@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BlueprintAssistMisc/BABlueprintSymbolIndex.h"
 #include "Engine/Blueprint.h"
 #include "UObject/Object.h"
 #include "BABlueprintHandlerObject.generated.h"
@@ -10,6 +11,17 @@
 class UEdGraph;
 class UK2Node_EditablePinBase;
 struct FKismetUserDeclaredFunctionMetadata;
+
+/**
+ * Last known state of a blueprint variable, the hash only covers the fields we react to when the blueprint changes
+ */
+struct FBAVariableSnapshot
+{
+	FBPVariableDescription Description;
+	uint32 Hash = 0;
+	uint32 LastSeenChange = 0;
+};
+
 /**
  * 
  */
@@ -53,15 +65,24 @@ public:
 
 	void DetectGraphIssues(UEdGraph* Graph);
 
+	static uint32 GetVariableHash(const FBPVariableDescription& Variable);
+
+	/** Compares everything GetVariableHash covers, used to confirm a variable is unchanged when the hashes match */
+	static bool HasVariableChanged(const FBPVariableDescription& OldVariable, const FBPVariableDescription& NewVariable);
+
+	FBABlueprintSymbolIndex& GetSymbolIndex() { return SymbolIndex; }
+
 private:
 	UPROPERTY()
 	TWeakObjectPtr<UBlueprint> BlueprintPtr;
 
-	UPROPERTY()
-	TArray<FBPVariableDescription> LastVariables;
+	TMap<FGuid, FBAVariableSnapshot> LastVariables;
 
-	UPROPERTY()
-	TArray<TWeakObjectPtr<UEdGraph>> LastFunctionGraphs;
+	TSet<TWeakObjectPtr<UEdGraph>> LastFunctionGraphs;
+
+	uint32 ChangeCounter = 0;
+
+	FBABlueprintSymbolIndex SymbolIndex;
 
 	bool bProcessedChangesThisFrame = false;
 
@@ -569,10 +569,6 @@ public:
 	// Experimental
 	////////////////////////////////////////////////////////////
 
-	/* Faster formatting will only format chains of nodes have been moved or had connections changed. Greatly increases speed of the format all command. */
-	UPROPERTY(EditAnywhere, config, Category = Experimental)
-	bool bEnableFasterFormatting;
-
 	/* Align execution nodes to the 8x8 grid when formatting */
 	UPROPERTY(EditAnywhere, config, Category = Experimental)
 	bool bAlignExecNodesTo8x8Grid;
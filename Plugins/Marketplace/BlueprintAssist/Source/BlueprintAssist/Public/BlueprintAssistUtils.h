@@ -147,12 +147,13 @@ struct BLUEPRINTASSIST_API FBAUtils
 
 	static FVector2D GetKnotNodeSize();
 
-	/** Adds a knot node connecting two pins */
+	/** Adds a knot node connecting two pins, without bNotifyGraph the caller has to broadcast the new node itself */
 	static UK2Node_Knot* CreateKnotNode(
 		UEdGraph* Graph,
 		const FVector2D& Position,
 		UEdGraphPin* PinA,
-		UEdGraphPin* PinB);
+		UEdGraphPin* PinB,
+		bool bNotifyGraph = true);
 
 	static void LinkKnotNodeBetween(UK2Node_Knot* Node, const FVector2D& Position, UEdGraphPin* PinA, UEdGraphPin* PinB);
 
@@ -0,0 +1,33 @@
+// Copyright 2021 fpwong. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class BlueprintAssistCommandlets : ModuleRules
+{
+	public BlueprintAssistCommandlets(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.NoPCHs;
+		bUseUnity = false;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"UnrealEd",
+				"BlueprintGraph",
+				"AssetRegistry",
+				"Json",
+				"JsonUtilities",
+				"BlueprintAssist"
+			}
+		);
+	}
+}
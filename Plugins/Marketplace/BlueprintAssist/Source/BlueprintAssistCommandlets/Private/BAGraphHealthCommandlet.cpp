@@ -0,0 +1,216 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BAGraphHealthCommandlet.h"
+
+#include "BlueprintAssistCache.h"
+#include "BlueprintAssistGlobals.h"
+#include "BlueprintAssistUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "BlueprintAssistMisc/BAGraphHealth.h"
+#include "Dom/JsonObject.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace BAGraphHealthCommandlet
+{
+	/** Reads the cached sizes without adding the package to the cache, so scanning the whole project doesn't grow it */
+	static const FBAGraphData& FindGraphData(UEdGraph* Graph, FBAGraphData& ScratchGraphData)
+	{
+		if (const FBAPackageData* PackageData = FBACache::Get().GetCacheData().PackageData.Find(Graph->GetOutermost()->GetFName()))
+		{
+			if (const FBAGraphData* GraphData = PackageData->GraphData.Find(FBAUtils::GetGraphGuid(Graph)))
+			{
+				return *GraphData;
+			}
+		}
+
+		ScratchGraphData = FBAGraphData();
+		FBACache::Get().LoadGraphDataFromPackageMetaData(Graph, ScratchGraphData);
+		return ScratchGraphData;
+	}
+
+	static FString SeverityToString(EMessageSeverity::Type Severity)
+	{
+		switch (Severity)
+		{
+			case EMessageSeverity::Error:
+				return TEXT("Error");
+			case EMessageSeverity::Warning:
+			case EMessageSeverity::PerformanceWarning:
+				return TEXT("Warning");
+			default:
+				return TEXT("Info");
+		}
+	}
+}
+
+UBAGraphHealthCommandlet::UBAGraphHealthCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UBAGraphHealthCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	TArray<FString> Paths;
+	ParamValues.FindRef(TEXT("Paths")).ParseIntoArray(Paths, TEXT("+"));
+	if (Paths.Num() == 0)
+	{
+		Paths.Add(TEXT("/Game"));
+	}
+
+	const FString* BatchSizeParam = ParamValues.Find(TEXT("BatchSize"));
+	const int32 BatchSize = BatchSizeParam ? FMath::Max(1, FCString::Atoi(**BatchSizeParam)) : 32;
+
+	const FString* OutputParam = ParamValues.Find(TEXT("Output"));
+	const FString OutputPath = OutputParam ? *OutputParam : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintAssist"), TEXT("GraphHealthReport.json"));
+
+	const bool bFailOnErrors = Switches.Contains(TEXT("FailOnErrors"));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	// node sizes come from the cache file written by the editor, or the package meta data
+	FBACache::Get().LoadCache();
+
+	FARFilter Filter;
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(*Path));
+	}
+
+	Filter.bRecursivePaths = true;
+#if BA_UE_VERSION_OR_LATER(5, 1)
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+#else
+	Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+#endif
+	Filter.bRecursiveClasses = true;
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	UE_LOG(LogBlueprintAssist, Display, TEXT("BAGraphHealth: Scanning %d blueprints in batches of %d"), Assets.Num(), BatchSize);
+
+	TArray<TSharedPtr<FJsonValue>> IssueValues;
+	TMap<EBAGraphIssueType, int32> IssueCounts;
+	int32 NumGraphs = 0;
+	int32 NumFailedToLoad = 0;
+	int32 NumErrors = 0;
+
+	FBAGraphData ScratchGraphData;
+	TArray<FBAGraphIssue> Issues;
+	TArray<UEdGraph*> Graphs;
+
+	for (int32 BatchStart = 0; BatchStart < Assets.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Assets.Num());
+
+		// queue the whole batch so the async loader can work on the packages in parallel
+		for (int32 AssetIndex = BatchStart; AssetIndex < BatchEnd; ++AssetIndex)
+		{
+			LoadPackageAsync(Assets[AssetIndex].PackageName.ToString());
+		}
+
+		FlushAsyncLoading();
+
+		for (int32 AssetIndex = BatchStart; AssetIndex < BatchEnd; ++AssetIndex)
+		{
+			const FAssetData& AssetData = Assets[AssetIndex];
+			UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+			if (!Blueprint)
+			{
+				UE_LOG(LogBlueprintAssist, Warning, TEXT("BAGraphHealth: Failed to load %s"), *AssetData.PackageName.ToString());
+				++NumFailedToLoad;
+				continue;
+			}
+
+			Graphs.Reset();
+			Blueprint->GetAllGraphs(Graphs);
+
+			for (UEdGraph* Graph : Graphs)
+			{
+				if (!Graph)
+				{
+					continue;
+				}
+
+				++NumGraphs;
+
+				const FBAGraphData& GraphData = BAGraphHealthCommandlet::FindGraphData(Graph, ScratchGraphData);
+
+				Issues.Reset();
+				FBAGraphHealth::DetectKnotIssues(Graph, Issues);
+				FBAGraphHealth::DetectDanglingKnots(Graph, Issues);
+				FBAGraphHealth::DetectOverlappingNodes(Graph, GraphData, Issues);
+				FBAGraphHealth::DetectUnformattedGraph(Graph, GraphData, Issues);
+
+				for (const FBAGraphIssue& Issue : Issues)
+				{
+					TSharedPtr<FJsonObject> IssueObject = MakeShared<FJsonObject>();
+					IssueObject->SetStringField(TEXT("Asset"), AssetData.PackageName.ToString());
+					IssueObject->SetStringField(TEXT("Graph"), FBAUtils::GetGraphName(Graph));
+					IssueObject->SetStringField(TEXT("Type"), FBAGraphHealth::IssueTypeToString(Issue.Type));
+					IssueObject->SetStringField(TEXT("Severity"), BAGraphHealthCommandlet::SeverityToString(Issue.Severity));
+					IssueObject->SetStringField(TEXT("Message"), Issue.Message);
+
+					if (UEdGraphNode* Node = Issue.Node.Get())
+					{
+						IssueObject->SetStringField(TEXT("Node"), FBAUtils::GetNodeName(Node));
+						IssueObject->SetStringField(TEXT("NodeGuid"), Node->NodeGuid.ToString());
+					}
+
+					IssueValues.Add(MakeShared<FJsonValueObject>(IssueObject));
+					IssueCounts.FindOrAdd(Issue.Type)++;
+					NumErrors += Issue.Severity == EMessageSeverity::Error ? 1 : 0;
+				}
+			}
+		}
+
+		Graphs.Reset();
+
+		// unload the batch before loading the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		UE_LOG(LogBlueprintAssist, Display, TEXT("BAGraphHealth: Scanned %d / %d blueprints, %d issues"), BatchEnd, Assets.Num(), IssueValues.Num());
+	}
+
+	TSharedPtr<FJsonObject> SummaryObject = MakeShared<FJsonObject>();
+	SummaryObject->SetNumberField(TEXT("Blueprints"), Assets.Num());
+	SummaryObject->SetNumberField(TEXT("Graphs"), NumGraphs);
+	SummaryObject->SetNumberField(TEXT("FailedToLoad"), NumFailedToLoad);
+	for (const TPair<EBAGraphIssueType, int32>& IssueCount : IssueCounts)
+	{
+		SummaryObject->SetNumberField(FBAGraphHealth::IssueTypeToString(IssueCount.Key), IssueCount.Value);
+	}
+
+	TSharedPtr<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+	ReportObject->SetObjectField(TEXT("Summary"), SummaryObject);
+	ReportObject->SetArrayField(TEXT("Issues"), IssueValues);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(ReportObject.ToSharedRef(), Writer);
+
+	if (!FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+	{
+		UE_LOG(LogBlueprintAssist, Error, TEXT("BAGraphHealth: Failed to write report to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogBlueprintAssist, Display, TEXT("BAGraphHealth: Wrote %d issues (%d errors) to %s"), IssueValues.Num(), NumErrors, *FPaths::ConvertRelativePathToFull(OutputPath));
+
+	return bFailOnErrors && NumErrors > 0 ? 1 : 0;
+}
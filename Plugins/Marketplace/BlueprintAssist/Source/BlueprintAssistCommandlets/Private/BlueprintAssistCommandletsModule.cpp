@@ -0,0 +1,6 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+// The main module is EditorNoCommandlet so its editor hooks never run in commandlets, the commandlets live here instead
+IMPLEMENT_MODULE(FDefaultModuleImpl, BlueprintAssistCommandlets)
@@ -0,0 +1,24 @@
+// Copyright fpwong. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BAGraphHealthCommandlet.generated.h"
+
+/**
+ * Scans the blueprints of the project for graph issues and writes a json report.
+ * Packages are loaded in batches and garbage collected between batches to keep memory bounded.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=BAGraphHealth [-Paths=/Game/A+/Game/B] [-BatchSize=32] [-Output=<File>] [-FailOnErrors]
+ */
+UCLASS()
+class BLUEPRINTASSISTCOMMANDLETS_API UBAGraphHealthCommandlet final : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBAGraphHealthCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -1,6 +1,9 @@
 // Copyright 2022 Guganana. All Rights Reserved.
 #include "Asset/ExpressiveTextAsset.h"
 #include "ExpressiveTextProcessor.h"
+#include "Subsystems/ExpressiveTextSubsystem.h"
+
+#include <Engine/Engine.h>
 
 
 void UExpressiveTextAsset::OnPreSave()
@@ -9,14 +12,37 @@ void UExpressiveTextAsset::OnPreSave()
 	Text.SetWorldContext(this);
 	Text.SetFields(Fields);
 
-	UExpressiveTextProcessor::CompileText(Text).Next(
+	// The harvested resources have to be stored before the asset is written
+	UExpressiveTextProcessor::CompileText(Text, EExTextCompilePriority::Immediate).Next(
 		[this, FieldsHandle = Fields.GetAliveHandle()](const FCompiledExpressiveText& InCompiledText)
 		{
 			if (FieldsHandle.IsValid())
 			{
 				Fields.ReferencedResources = InCompiledText.HarvestedResources;
+				Fields.ResourceManifest = FExpressiveTextResourceManifest::FromResources(InCompiledText.HarvestedResources);
 			}
 		}
 	);
 
-}
\ No newline at end of file
+}
+
+void UExpressiveTextFunctions::WarmResources(const TArray<UExpressiveTextAsset*>& Assets, FOnExpressiveTextResourcesWarmed OnWarmed)
+{
+	if (auto* Subsystem = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>())
+	{
+		Subsystem->WarmTexts(Assets).Next(
+			[OnWarmed](auto)
+			{
+				OnWarmed.ExecuteIfBound();
+			}
+		);
+	}
+}
+
+void UExpressiveTextFunctions::ReleaseWarmedResources()
+{
+	if (auto* Subsystem = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>())
+	{
+		Subsystem->ReleaseWarmedResources();
+	}
+}
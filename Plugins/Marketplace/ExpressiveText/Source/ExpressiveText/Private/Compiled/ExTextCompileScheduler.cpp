@@ -0,0 +1,124 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#include "Compiled/ExTextCompileScheduler.h"
+
+#include "Compiled/ExpressiveTextCompiler.h"
+#include "ExpressiveTextSettings.h"
+
+FExTextCompileScheduler::FExTextCompileScheduler()
+	: Jobs()
+	, NextOrder(0)
+	, BudgetFrame(0)
+	, BudgetSpent(0.0)
+	, SlicedThisFrame(false)
+	, DeferredThisFrame(false)
+	, IsRunning(false)
+	, Stats()
+{
+}
+
+TFuture<FCompiledExpressiveText> FExTextCompileScheduler::Enqueue(FExpressiveText ExpressiveText, EExTextCompilePriority Priority, TOptional<FString> AppendedLines)
+{
+	TSharedRef<FExpressiveTextCompiler> Compiler = FExpressiveTextCompiler::MakeCompiler();
+
+	if (Priority == EExTextCompilePriority::Immediate)
+	{
+		return AppendedLines.IsSet() ? Compiler->Append(ExpressiveText, AppendedLines.GetValue()) : Compiler->Compile(ExpressiveText);
+	}
+
+	Compiler->EnableSlicing();
+	TFuture<FCompiledExpressiveText> Result = AppendedLines.IsSet() ? Compiler->Append(ExpressiveText, AppendedLines.GetValue()) : Compiler->Compile(ExpressiveText);
+
+	Jobs.Add({ Compiler, Priority, FPlatformTime::Seconds(), NextOrder++ });
+	Stats.QueueDepth = Jobs.Num();
+	Stats.MaxQueueDepth = FMath::Max(Stats.MaxQueueDepth, Stats.QueueDepth);
+
+	// Work right away while the frame still has budget so lone texts aren't delayed by a frame.
+	// Compiles queued from the completion of another one are picked up by the loop already running.
+	if (!IsRunning)
+	{
+		RunJobs();
+	}
+
+	return Result;
+}
+
+void FExTextCompileScheduler::RunJobs()
+{
+	if (Jobs.Num() == 0)
+	{
+		return;
+	}
+
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		BudgetSpent = 0.0;
+		SlicedThisFrame = false;
+		DeferredThisFrame = false;
+	}
+
+	const auto* Settings = GetDefault<UExpressiveTextSettings>();
+	const double Budget = Settings && Settings->CompileBudgetMs > 0.f ? Settings->CompileBudgetMs / 1000.0 : TNumericLimits<double>::Max();
+
+	// Always let one slice through per frame, otherwise a frame that spent its budget elsewhere would starve the queue
+	if (BudgetSpent >= Budget && SlicedThisFrame)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double EndTime = Budget == TNumericLimits<double>::Max() ? Budget : StartTime + FMath::Max(0.0, Budget - BudgetSpent);
+
+	Jobs.Sort(
+		[](const FJob& A, const FJob& B)
+		{
+			return A.Priority != B.Priority ? A.Priority > B.Priority : A.Order < B.Order;
+		}
+	);
+
+	TGuardValue<bool> RunningGuard(IsRunning, true);
+
+	// Iterated by index since finishing a compile can queue new ones
+	for (int32 JobIndex = 0; JobIndex < Jobs.Num(); JobIndex++)
+	{
+		if (SlicedThisFrame && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+
+		TSharedRef<FExpressiveTextCompiler> Compiler = Jobs[JobIndex].Compiler;
+		if (Compiler->CanCompileSlice())
+		{
+			Compiler->CompileSlice(EndTime);
+			SlicedThisFrame = true;
+		}
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	BudgetSpent += Now - StartTime;
+	Stats.LastFrameTime = BudgetSpent;
+
+	Jobs.RemoveAll(
+		[this, Now](const FJob& Job)
+		{
+			if (Job.Compiler->GetStage() != EExTextCompileStage::Finished)
+			{
+				return false;
+			}
+
+			const double Latency = Now - Job.QueuedTime;
+			Stats.AverageLatency += (Latency - Stats.AverageLatency) / ++Stats.CompletedJobs;
+			Stats.MaxLatency = FMath::Max(Stats.MaxLatency, Latency);
+			return true;
+		}
+	);
+
+	Stats.QueueDepth = Jobs.Num();
+
+	const bool HasReadyJobs = Jobs.ContainsByPredicate([](const FJob& Job) { return Job.Compiler->CanCompileSlice(); });
+	if (HasReadyJobs && Now >= EndTime && !DeferredThisFrame)
+	{
+		DeferredThisFrame = true;
+		Stats.DeferredFrames++;
+	}
+}
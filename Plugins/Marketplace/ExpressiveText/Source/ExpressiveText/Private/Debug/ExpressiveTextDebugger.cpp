@@ -37,6 +37,7 @@ void AExpressiveTextDebugger::Tick(float DeltaTime)
 
     AllStylesStatus.Empty();
     AllFontsStatus.Empty();
+    RuntimeStats.Empty();
 
     if (GEngine)
     {
@@ -63,6 +64,25 @@ void AExpressiveTextDebugger::Tick(float DeltaTime)
             {
                 AllFontsStatus.Emplace( CreateMessageForSoftPtr( Font ) );
             }
+
+            const FExTextInternStats& InternStats = Subsystem->GetInternStats();
+            RuntimeStats.Emplace(
+                FString::Printf( TEXT("Interned values: %d unique, %d requests, %d allocations avoided"), Subsystem->GetNumInternedValues(), InternStats.Requests, InternStats.Hits ),
+                FColor::White
+            );
+
+            const FExTextGlyphShapingCache& ShapingCache = Subsystem->GetGlyphShapingCache();
+            const int32 ShapingRequests = ShapingCache.GetHits() + ShapingCache.GetMisses();
+            RuntimeStats.Emplace(
+                FString::Printf( TEXT("Glyph shaping cache: %d entries, %.1f%% hit rate (%d/%d)"), ShapingCache.Num(), ShapingRequests > 0 ? 100.f * ShapingCache.GetHits() / ShapingRequests : 0.f, ShapingCache.GetHits(), ShapingRequests ),
+                FColor::White
+            );
+
+            const FExTextCompileSchedulerStats& SchedulerStats = Subsystem->GetCompileScheduler().GetStats();
+            RuntimeStats.Emplace(
+                FString::Printf( TEXT("Compile queue: %d queued (max %d), %d compiled, latency %.1fms avg / %.1fms max, %d frames over budget"), SchedulerStats.QueueDepth, SchedulerStats.MaxQueueDepth, SchedulerStats.CompletedJobs, SchedulerStats.AverageLatency * 1000.0, SchedulerStats.MaxLatency * 1000.0, SchedulerStats.DeferredFrames ),
+                SchedulerStats.QueueDepth > 0 ? FColor::Yellow : FColor::White
+            );
         }
     }
 }
\ No newline at end of file
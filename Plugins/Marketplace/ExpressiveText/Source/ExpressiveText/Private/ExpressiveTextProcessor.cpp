@@ -13,10 +13,25 @@ void UExpressiveTextProcessor::GetExtractions(UObject* WorldContext, FExpressive
 }
 #endif
 
-TFuture<FCompiledExpressiveText> UExpressiveTextProcessor::CompileText(FExpressiveText ExpressiveText )
+TFuture<FCompiledExpressiveText> UExpressiveTextProcessor::CompileText(FExpressiveText ExpressiveText, EExTextCompilePriority Priority)
 {
-	TFuture<FCompiledExpressiveText> Future = FExpressiveTextCompiler::MakeCompiler()->Compile(ExpressiveText);
-	return Future;
+	auto* Subsystem = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>();
+	check(Subsystem);
+
+	return Subsystem->GetCompileScheduler().Enqueue(ExpressiveText, Priority);
+}
+
+TFuture<FCompiledExpressiveText> UExpressiveTextProcessor::CompileAppendedText(FExpressiveText ExpressiveText, const FString& NewLines, EExTextCompilePriority Priority)
+{
+	auto* Subsystem = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>();
+	check(Subsystem);
+
+	return Subsystem->GetCompileScheduler().Enqueue(ExpressiveText, Priority, NewLines);
+}
+
+bool UExpressiveTextProcessor::ApplyTemplateValue(const FExpressiveText& ExpressiveText, const FName& Key, const FString& Value)
+{
+	return FExpressiveTextCompiler::ApplyTemplateValue(ExpressiveText, Key, Value);
 }
 
 
@@ -31,6 +31,20 @@ int64 FExpressiveTextInternal::CalcChecksum() const
 {
 	int64 Result = 0;
 	Result = HashCombine(Result, Fields.CalcChecksum());
+
+	// Only the keys change how the text compiles, values are swapped in the compiled text.
+	// Combined in any order since the map order depends on when each key was added.
+	if (TemplateDictionary.Num() > 0)
+	{
+		uint32 TemplateKeysHash = 0;
+		for (const auto& TemplateValue : TemplateDictionary)
+		{
+			TemplateKeysHash ^= GetTypeHash(TemplateValue.Key);
+		}
+
+		Result = HashCombine(Result, TemplateKeysHash);
+	}
+
 	return Result;
 }
 
@@ -175,6 +189,51 @@ void FExpressiveText::DisableDefaultFontSize()
 	Internal->SetDefaultFontSize(false);
 }
 
+void FExpressiveText::AppendText(const FString& NewLines)
+{
+	FString Text = Internal->GetFields().Text.ToString();
+	if (!Text.IsEmpty())
+	{
+		Text += TEXT("\n");
+	}
+	Text += NewLines;
+
+	// Keep the fields in sync with the lines the layout keeps, so a full recompile shows the same history
+	if (Internal->MaxHistoryLines > 0)
+	{
+		TArray<FString> Lines;
+		Text.ParseIntoArrayLines(Lines, false);
+
+		if (Lines.Num() > Internal->MaxHistoryLines)
+		{
+			Lines.RemoveAt(0, Lines.Num() - Internal->MaxHistoryLines);
+			Text = FString::Join(Lines, TEXT("\n"));
+		}
+	}
+
+	Internal->SetText(FText::FromString(Text));
+}
+
+void FExpressiveText::SetMaxHistoryLines(int32 MaxHistoryLines)
+{
+	Internal->MaxHistoryLines = FMath::Max(0, MaxHistoryLines);
+}
+
+int32 FExpressiveText::GetMaxHistoryLines() const
+{
+	return Internal->MaxHistoryLines;
+}
+
+void FExpressiveText::SetVirtualized(bool Virtualized)
+{
+	Internal->Virtualized = Virtualized;
+}
+
+bool FExpressiveText::IsVirtualized() const
+{
+	return Internal->Virtualized;
+}
+
 FExpressiveText FExpressiveText::Clone() const
 {
 	FExpressiveText NewClone;
@@ -193,6 +252,11 @@ const FExpressiveTextContext& FExpressiveText::GetContext() const
 	return Internal->Context;
 }
 
+const TMap<FName, FString>& FExpressiveText::GetTemplateDictionary() const
+{
+	return Internal->TemplateDictionary;
+}
+
 TOptional<int32> FExpressiveText::GetDefaultFontSize() const
 {
 	const auto& Fields = Internal->GetFields();
@@ -214,6 +278,34 @@ FVector2D FExpressiveText::GetSize() const
 	return FVector2D::ZeroVector;
 }
 
+bool FExpressiveText::FindGlyphAtLocation(FVector2D Position, float Scaling, FExpressiveTextGlyphInformation& OutGlyph) const
+{
+	return FindGlyphInLayout(Internal->TextLayout.Get(), Position, Scaling, OutGlyph);
+}
+
+bool FExpressiveText::FindGlyphInLayout(const FExpressiveTextSlateLayout& TextLayout, FVector2D Position, float Scaling, FExpressiveTextGlyphInformation& OutGlyph)
+{
+	OutGlyph = FExpressiveTextGlyphInformation();
+
+	Position -= TextLayout.GetSharedData()->AlignmentOffset;
+	Position *= Scaling * TextLayout.GetScale();
+
+	FExTextGlyphHit Hit;
+	if (!TextLayout.FindGlyphAt(Position, Hit))
+	{
+		return false;
+	}
+
+	OutGlyph.LineIndex = Hit.LineIndex;
+	OutGlyph.CharacterIndex = Hit.CharacterIndex;
+	OutGlyph.WordStart = Hit.WordRange.BeginIndex;
+	OutGlyph.WordEnd = Hit.WordRange.EndIndex;
+	OutGlyph.TagStart = Hit.SourceRange.BeginIndex;
+	OutGlyph.TagEnd = Hit.SourceRange.EndIndex;
+	OutGlyph.StyleName = Hit.StyleName;
+	return true;
+}
+
 void FExpressiveText::GetLineSizes( TArray<FVector2D>& OutLineSizes ) const
 {
 	for ( const FTextLayout::FLineView& Line : Internal->TextLayout->GetLineViews())
@@ -119,8 +119,10 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 	const auto& ClearGlyphAnim = Lookup->GetValue<UExTextValue_ClearAnimation>();
 	const float ClearAnimDuration = Lookup->GetValue<UExTextValue_ClearAnimationDuration>();
 	const float AnimLoopPeriod = Lookup->GetValue<UExTextValue_AnimationLoopPeriod>();
+	const bool EvaluateAnimationOnGPU = ShouldEvaluateAnimationOnGPU();
 
-	if (IsClearing)
+	// Runs evaluated on the GPU are drawn whole, per glyph transforms come from the baked curves in the font material
+	if (!EvaluateAnimationOnGPU && IsClearing)
 	{
 		if (ClearGlyphAnim.Animation)
 		{
@@ -128,7 +130,7 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 		}
 
 	}
-	else
+	else if (!EvaluateAnimationOnGPU)
 	{
 		if (GlyphAnim.Animation)
 		{
@@ -147,6 +149,29 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 	float FontAtlasScale = Payload.MaxDisplayedScale * InitialAllottedGeometry.GetAccumulatedLayoutTransform().GetScale();
 
 
+	// Runs drawing the same text with the same font share their shaping through the plugin cache, every pass included
+	auto& GlyphShapingCache = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>()->GetGlyphShapingCache();
+	const bool CanUseGlyphShapingCache = FExTextGlyphShapingCache::CanShapeInIsolation(BlockTextContext.TextShapingMethod, BlockTextContext.TextDirection);
+	const float ShapingScale = CanUseGlyphShapingCache ? FExTextGlyphShapingCache::QuantizeFontScale(FontAtlasScale) : FontAtlasScale;
+	const float ShapingScaleCompensation = FontAtlasScale / ShapingScale;
+
+	const auto ShapeRange = [&](const FTextRange& RangeToShape, const FSlateFontInfo& FontInfoToShape)
+	{
+		if (CanUseGlyphShapingCache)
+		{
+			return GlyphShapingCache.GetShapedGlyphs(FStringView(**Text + RangeToShape.BeginIndex, RangeToShape.Len()), FontInfoToShape, ShapingScale, BlockTextContext.TextShapingMethod, BlockTextContext.TextDirection);
+		}
+
+		// We use the full line view range (rather than the run range) so that text that spans runs will still be shaped correctly
+		return ShapedTextCacheUtil::GetShapedTextSubSequence(
+			BlockTextContext.ShapedTextCache,
+			FCachedShapedTextKey(Line.Range, FontAtlasScale, BlockTextContext, FontInfoToShape),
+			RangeToShape,
+			**Text,
+			BlockTextContext.TextDirection
+		);
+	};
+
 	// Reveal logic
 	FTextRange BlockRange = Block->GetTextRange();
 	const float ClearRate = Lookup->GetValue< UExTextValue_ClearRate >();
@@ -216,14 +241,8 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 				{
 					FTextRange HiddenRange(BlockRange.BeginIndex, BlockRange.BeginIndex + NumGlyphsToHideInThisBlock);
 
-					auto HiddenShapedText = ShapedTextCacheUtil::GetShapedTextSubSequence(
-						BlockTextContext.ShapedTextCache,
-						FCachedShapedTextKey(Line.Range, FontAtlasScale, BlockTextContext, FontInfo),
-						HiddenRange,
-						**Text,
-						BlockTextContext.TextDirection
-					);
-					BlockOffset.X += HiddenShapedText->GetMeasuredWidth() / InitialAllottedGeometry.GetAccumulatedLayoutTransform().GetScale();
+					auto HiddenShapedText = ShapeRange(HiddenRange, FontInfo);
+					BlockOffset.X += HiddenShapedText->GetMeasuredWidth() * ShapingScaleCompensation / InitialAllottedGeometry.GetAccumulatedLayoutTransform().GetScale();
 					BlockRange.BeginIndex = BlockRange.BeginIndex + NumGlyphsToHideInThisBlock;
 				}
 				else
@@ -247,7 +266,12 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 	}
 
 	bool ShouldReturn = false;
-	if (IsClearing)
+	if (EvaluateAnimationOnGPU)
+	{
+		// The whole block is submitted once, the font material hides glyphs not yet revealed or already cleared
+		ShouldReturn = RevealRate > 0.f && NumGlyphsToRevealInThisBlock <= 0;
+	}
+	else if (IsClearing)
 	{
 		ModulateClear(ShouldReturn);
 	}
@@ -315,6 +339,10 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 
 	FGeometry TextGeom = BaseGeom.MakeChild(DrawTextOffset - FVector2D( FontInfo.OutlineSettings.OutlineSize, 0.f ) );
 
+	// Glyphs shaped at a rounded up font scale draw that much bigger, these bring them back to the size they were laid out at
+	const FGeometry GlyphGeom = TextGeom.MakeChild(FSlateRenderTransform(ShapingScaleCompensation), FVector2D::ZeroVector);
+	const FGeometry ShadowGlyphGeom = BaseGeom.MakeChild(FSlateRenderTransform(ShapingScaleCompensation), FVector2D::ZeroVector);
+
 	if (Payload.ShouldClip)
 	{
 		const FVector2D TextSize = TextGeom.GetLocalSize() * OriginalInverseScale;
@@ -330,6 +358,14 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 		SharedData->Chronos.GetStartTime() + RevealStartTime + ClearTimer
 	);
 
+	// Reveal and clear information is baked with absolute times so materials need refreshing when the text restarts
+	if (CachedMIDStartTime != SharedData->Chronos.GetStartTime())
+	{
+		CachedMIDStartTime = SharedData->Chronos.GetStartTime();
+		CachedMID.Reset();
+		CachedOutlineMID.Reset();
+	}
+
 	const auto FetchCachedMaterial = [this,&RevealAndClearInformation, &TextGeom,&Line,&FontSizeCompensation](const UExTextValue_MaterialBase& ExTextMaterialParam)
 	{
 		if (UMaterialInstanceConstant* CombinedMaterial = ExTextMaterialParam.CombinedMaterial)
@@ -404,14 +440,7 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 #endif
 
 	// Make sure we have up-to-date shaped text to work with
-	// We use the full line view range (rather than the run range) so that text that spans runs will still be shaped correctly
-	FShapedGlyphSequenceRef ShapedText = ShapedTextCacheUtil::GetShapedTextSubSequence(
-		BlockTextContext.ShapedTextCache,
-		FCachedShapedTextKey(Line.Range, FontAtlasScale, BlockTextContext, FontInfo),
-		BlockRange,
-		**Text,
-		BlockTextContext.TextDirection
-	);
+	FShapedGlyphSequenceRef ShapedText = ShapeRange(BlockRange, FontInfo);
 
 	// Draw the optional shadow
 	if (ShouldDropShadow)
@@ -429,19 +458,13 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 			}
 
 			// Create new shaped text for drop shadow
-			ShadowShapedText = ShapedTextCacheUtil::GetShapedTextSubSequence(
-				BlockTextContext.ShapedTextCache,
-				FCachedShapedTextKey(Line.Range, FontAtlasScale, BlockTextContext, ShadowFontInfo),
-				BlockRange,
-				**Text,
-				BlockTextContext.TextDirection
-			);
+			ShadowShapedText = ShapeRange(BlockRange, ShadowFontInfo);
 		}
 
 		FSlateDrawElement::MakeShapedText(
 			OutDrawElements,
 			++LayerId,
-			BaseGeom.ToPaintGeometry(FSlateLayoutTransform( DrawShadowOffset )),
+			ShadowGlyphGeom.ToPaintGeometry(FSlateLayoutTransform( DrawShadowOffset / ShapingScaleCompensation )),
 			ShadowShapedText,
 			DrawEffects,
 			InWidgetStyle.GetColorAndOpacityTint() * Payload.DropShadowColor,
@@ -456,7 +479,7 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 		FSlateDrawElement::MakeShapedText(
 			OutDrawElements,
 			++LayerId,
-			TextGeom.ToPaintGeometry(),
+			GlyphGeom.ToPaintGeometry(),
 			ShapedText,
 			DrawEffects,
 			InWidgetStyle.GetColorAndOpacityTint() * Payload.FontColor,
@@ -465,7 +488,7 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 	}
 	else
 	{
-		const FGeometry OutlineGeom = TextGeom.MakeChild( FSlateRenderTransform(FScale2D(Payload.OutlineRenderSize)) );
+		const FGeometry OutlineGeom = GlyphGeom.MakeChild( FSlateRenderTransform(FScale2D(Payload.OutlineRenderSize)) );
 		FSlateDrawElement::MakeShapedText(
 			OutDrawElements,
 			++LayerId,
@@ -481,7 +504,7 @@ int32 FExpressiveTextRun::OnPaint(const FPaintArgs& Args, const FTextArgs& TextA
 		FSlateDrawElement::MakeShapedText(
 			OutDrawElements,
 			++LayerId,
-			TextGeom.ToPaintGeometry(),
+			GlyphGeom.ToPaintGeometry(),
 			ShapedText,
 			DrawEffects,
 			InWidgetStyle.GetColorAndOpacityTint() * Payload.FontColor,
@@ -522,6 +545,38 @@ float FExpressiveTextRun::CalculateDurationToFullyReveal() const
 }
 
 
+void FExpressiveTextRun::AppendGlyphRevealTimes(TArray<float>& OutRevealTimes) const
+{
+	const float RevealRate = Lookup->GetValue<UExTextValue_RevealRate>();
+
+	OutRevealTimes.Reserve(OutRevealTimes.Num() + Range.Len());
+
+	// Without a reveal rate the whole run shows as soon as it starts
+	if (RevealRate <= 0.f)
+	{
+		for (int32 GlyphIndex = Range.BeginIndex; GlyphIndex < Range.EndIndex; GlyphIndex++)
+		{
+			OutRevealTimes.Add(RevealStartTime);
+		}
+		return;
+	}
+
+	// Glyphs at or after an interjection are held back by every pause up to it
+	int32 InterjectionIndex = 0;
+	float AccumulatedPauseTime = 0.f;
+
+	for (int32 GlyphIndex = Range.BeginIndex; GlyphIndex < Range.EndIndex; GlyphIndex++)
+	{
+		while (Interjections.IsValidIndex(InterjectionIndex) && Interjections[InterjectionIndex].Index <= GlyphIndex)
+		{
+			AccumulatedPauseTime = Interjections[InterjectionIndex].AccumulatedPauseTime;
+			InterjectionIndex++;
+		}
+
+		OutRevealTimes.Add(RevealStartTime + (GlyphIndex - Range.BeginIndex) / RevealRate + AccumulatedPauseTime);
+	}
+}
+
 float FExpressiveTextRun::CalculateDurationToFullyClear() const
 {
 	const float ClearRate = Lookup->GetValue<UExTextValue_ClearRate>();
@@ -564,6 +619,28 @@ void FExpressiveTextRun::SetInterjections(const TArray<FExText_ParsedInterjectio
 }
 
 
+bool FExpressiveTextRun::ShouldEvaluateAnimationOnGPU() const
+{
+	return CanEvaluateAnimationOnGPU(*Lookup, Interjections.Num() > 0);
+}
+
+bool FExpressiveTextRun::CanEvaluateAnimationOnGPU(const FExpressiveTextParameterLookup& InLookup, bool HasInterjections)
+{
+	if (!InLookup.GetValue<UExTextValue_EvaluateAnimationOnGPU>())
+	{
+		return false;
+	}
+
+	// Interjections and per character actions need to know the exact glyph being revealed on the CPU
+	if (HasInterjections || InLookup.GetValue<UExTextValue_PerCharacterAction>() != nullptr)
+	{
+		return false;
+	}
+
+	// Without a font material layer sampling the baked curves the glyphs would never animate, keep the CPU path
+	return InLookup.GetValueObject<UExTextValue_Material>().RequiresDynamicParameter(EExTextDynamicMaterialParameters::GlyphAnimation);
+}
+
 void FExpressiveTextRun::FireInterjections( int32 SpecificIndex ) const
 {
 	if (UWorld* RawWorld = World.Get())
@@ -624,6 +701,29 @@ void FExpressiveTextRun::FillMaterialRequest(const UExpressiveTextMaterial& Mate
 	{
 		Request.AddScalar(MakeInfo("LineIndex"), LineIndex);
 	}
+
+	if (Material.RequiresDynamicParameter(EExTextDynamicMaterialParameters::GlyphAnimation))
+	{
+		// Glyph index within the run comes from the vertex id, the material offsets it by the run start
+		Request.AddScalar(MakeInfo("RunStartIndex"), Range.BeginIndex);
+		Request.AddScalar(MakeInfo("AnimationLoopPeriod"), Lookup->GetValue<UExTextValue_AnimationLoopPeriod>());
+
+		const auto& RevealAnim = Lookup->GetValue<UExTextValue_RevealAnimation>();
+		if (RevealAnim.Animation)
+		{
+			Request.AddTexture(MakeInfo("GlyphRevealAnimation"), RevealAnim.Animation->GetBakedCurvesTexture());
+			Request.AddScalar(MakeInfo("GlyphRevealAnimationDuration"), Lookup->GetValue<UExTextValue_AnimationDuration>());
+			Request.AddScalar(MakeInfo("GlyphRevealAnimationReverse"), RevealAnim.Reverse ? 1.f : 0.f);
+		}
+
+		const auto& ClearAnim = Lookup->GetValue<UExTextValue_ClearAnimation>();
+		if (ClearAnim.Animation)
+		{
+			Request.AddTexture(MakeInfo("GlyphClearAnimation"), ClearAnim.Animation->GetBakedCurvesTexture());
+			Request.AddScalar(MakeInfo("GlyphClearAnimationDuration"), Lookup->GetValue<UExTextValue_ClearAnimationDuration>());
+			Request.AddScalar(MakeInfo("GlyphClearAnimationReverse"), ClearAnim.Reverse ? 1.f : 0.f);
+		}
+	}
 }
 
 
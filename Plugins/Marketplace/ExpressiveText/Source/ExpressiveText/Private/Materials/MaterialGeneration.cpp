@@ -10,6 +10,25 @@
 
 #if WITH_EDITOR
 #include <MaterialUtilities.h>
+
+namespace MaterialGenerationCache
+{
+    // Transient combined materials by layer stack hash, styles resolving to the same stack share the permutation.
+    // Instances in here can be handed to several previews at once so they are never modified again
+    static TMap<uint32, TWeakObjectPtr<UMaterialInstanceConstant>> GeneratedPermutations;
+
+    static bool IsCached(const UMaterialInstanceConstant* Material)
+    {
+        for (const auto& Pair : GeneratedPermutations)
+        {
+            if (Pair.Value.Get() == Material)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
 #endif
 
 FMaterialLayersFunctions MaterialGeneration::GetLayers(const UMaterialInstance* Material, const FStaticParameterSet& StaticParameters)
@@ -47,7 +66,47 @@ void MaterialGeneration::SetLayers(UMaterialInstance* Material, FStaticParameter
 #endif
 }
 
-void MaterialGeneration::ReconstructCombinedMaterial(UObject* Outer, UMaterialInstanceConstant*& ExistingMaterial, const TArray<UExpressiveTextMaterial*>& ExTextMats, bool MarkAsDirty)
+uint32 MaterialGeneration::HashLayerStack(const TArray<UExpressiveTextMaterial*>& ExTextMats)
+{
+    uint32 Hash = 0;
+
+#if WITH_EDITOR
+    if (auto* Settings = GetDefault<UExpressiveTextSettings>())
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Settings->BaseTextMaterial.ToSoftObjectPath().ToString()));
+        Hash = HashCombine(Hash, GetTypeHash(Settings->BaseTextLayer.ToSoftObjectPath().ToString()));
+        Hash = HashCombine(Hash, GetTypeHash(Settings->BaseTextLayerBlend.ToSoftObjectPath().ToString()));
+
+        // The paths alone miss edits to the base assets, their state ids change whenever their graphs do
+        if (const auto* BaseMaterial = Settings->BaseTextMaterial.LoadSynchronous())
+        {
+            Hash = HashCombine(Hash, GetTypeHash(BaseMaterial->StateId));
+        }
+        if (const auto* BaseLayer = Settings->BaseTextLayer.LoadSynchronous())
+        {
+            Hash = HashCombine(Hash, GetTypeHash(BaseLayer->StateId));
+        }
+        if (const auto* BaseBlend = Settings->BaseTextLayerBlend.LoadSynchronous())
+        {
+            Hash = HashCombine(Hash, GetTypeHash(BaseBlend->StateId));
+        }
+    }
+
+    for (const auto* ExTextMat : ExTextMats)
+    {
+        if (ExTextMat && ExTextMat->MaterialLayer)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(ExTextMat->MaterialLayer->GetPathName()));
+            // Changes when the layer graph itself is edited, which also requires a new permutation
+            Hash = HashCombine(Hash, GetTypeHash(ExTextMat->MaterialLayer->StateId));
+        }
+    }
+#endif
+
+    return Hash;
+}
+
+void MaterialGeneration::ReconstructCombinedMaterial(UObject* Outer, UMaterialInstanceConstant*& ExistingMaterial, const TArray<UExpressiveTextMaterial*>& ExTextMats, bool MarkAsDirty, uint32* InOutLayerStackHash)
 {
 #if WITH_EDITOR
     auto* Settings = GetDefault<UExpressiveTextSettings>();
@@ -56,12 +115,57 @@ void MaterialGeneration::ReconstructCombinedMaterial(UObject* Outer, UMaterialIn
         return;
     }
 
+    const uint32 LayerStackHash = HashLayerStack(ExTextMats);
+    if (ExistingMaterial && InOutLayerStackHash && *InOutLayerStackHash == LayerStackHash)
+    {
+        return;
+    }
+
     if (Outer == nullptr)
     {
         Outer = GetTransientPackage();
         check(Outer);
     }
 
+    auto& GeneratedPermutations = MaterialGenerationCache::GeneratedPermutations;
+    if (auto* Cached = GeneratedPermutations.FindRef(LayerStackHash).Get())
+    {
+        if (Cached != ExistingMaterial)
+        {
+            if (Outer == GetTransientPackage())
+            {
+                // Transient previews can point straight at the cached instance
+                ExistingMaterial = Cached;
+            }
+            else
+            {
+                // Assets need an instance they own, the duplicate keeps the already compiled static permutation
+                ExistingMaterial = DuplicateObject<UMaterialInstanceConstant>(Cached, Outer, FName(*FGuid::NewGuid().ToString()));
+                check(ExistingMaterial);
+                ExistingMaterial->SetFlags(RF_Public);
+                ExistingMaterial->ClearFlags(RF_Transient);
+                ExistingMaterial->InitStaticPermutation();
+
+                if (MarkAsDirty)
+                {
+                    ExistingMaterial->MarkPackageDirty();
+                }
+            }
+        }
+
+        if (InOutLayerStackHash)
+        {
+            *InOutLayerStackHash = LayerStackHash;
+        }
+        return;
+    }
+
+    // Cached instances may be shared by several previews, leave it untouched and generate a new one
+    if (ExistingMaterial && MaterialGenerationCache::IsCached(ExistingMaterial))
+    {
+        ExistingMaterial = nullptr;
+    }
+
     if (ExistingMaterial == nullptr)
     {
         auto* BaseMaterial = Settings->BaseTextMaterial.LoadSynchronous();
@@ -154,5 +258,24 @@ void MaterialGeneration::ReconstructCombinedMaterial(UObject* Outer, UMaterialIn
     ExistingMaterial->UpdateStaticPermutation(SourceStaticParameters, ExistingMaterial->BasePropertyOverrides, true);
     ExistingMaterial->InitStaticPermutation();
     ExistingMaterial->PostEditChange();
+
+    // Only transient instances are shared, asset owned ones stay with their asset and can be regenerated in place
+    if (ExistingMaterial->GetOutermost() == GetTransientPackage())
+    {
+        for (auto It = GeneratedPermutations.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        GeneratedPermutations.Add(LayerStackHash, ExistingMaterial);
+    }
+
+    if (InOutLayerStackHash)
+    {
+        *InOutLayerStackHash = LayerStackHash;
+    }
 #endif
 }
@@ -0,0 +1,91 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#include "Resources/ExpressiveTextResourceManifest.h"
+
+#include "Parameters/ExpressiveTextParams.h"
+#include "Styles/ExpressiveTextStyleBase.h"
+
+#include <Engine/AssetManager.h>
+
+FExpressiveTextResourceManifest FExpressiveTextResourceManifest::FromResources( const TArray<UObject*>& Resources )
+{
+	FExpressiveTextResourceManifest Result;
+
+	for (UObject* Resource : Resources)
+	{
+		Result.AddResource(Resource);
+	}
+
+	return Result;
+}
+
+void FExpressiveTextResourceManifest::Append( const FExpressiveTextResourceManifest& Other )
+{
+	for (const FPrimaryAssetId& AssetId : Other.PrimaryAssets)
+	{
+		PrimaryAssets.AddUnique(AssetId);
+	}
+
+	for (const FSoftObjectPath& Material : Other.Materials)
+	{
+		Materials.AddUnique(Material);
+	}
+}
+
+void FExpressiveTextResourceManifest::GatherSoftObjectPaths( TArray<FSoftObjectPath>& OutPaths ) const
+{
+	auto& Manager = UAssetManager::Get();
+
+	for (const FPrimaryAssetId& AssetId : PrimaryAssets)
+	{
+		const FSoftObjectPath AssetPath = Manager.GetPrimaryAssetPath(AssetId);
+		if (AssetPath.IsValid())
+		{
+			OutPaths.AddUnique(AssetPath);
+		}
+	}
+
+	for (const FSoftObjectPath& Material : Materials)
+	{
+		if (Material.IsValid())
+		{
+			OutPaths.AddUnique(Material);
+		}
+	}
+}
+
+void FExpressiveTextResourceManifest::AddResource( UObject* Resource )
+{
+	auto* PrimaryAsset = Cast<UPrimaryDataAsset>(Resource);
+	if (!PrimaryAsset)
+	{
+		return;
+	}
+
+	const FPrimaryAssetId AssetId = PrimaryAsset->GetPrimaryAssetId();
+	if (!AssetId.IsValid() || PrimaryAssets.Contains(AssetId))
+	{
+		return;
+	}
+
+	PrimaryAssets.Add(AssetId);
+
+	// Styles pull in their materials and inherited styles too
+	if (auto* Style = Cast<UExpressiveTextStyleBase>(Resource))
+	{
+		for (const auto& Parameter : Style->Parameters)
+		{
+			if (auto* MaterialParameter = Cast<UExTextValue_MaterialBase>(Parameter.Value))
+			{
+				if (MaterialParameter->CombinedMaterial)
+				{
+					Materials.AddUnique(FSoftObjectPath(MaterialParameter->CombinedMaterial));
+				}
+			}
+		}
+
+		for (auto* InheritedStyle : Style->InheritedStyles)
+		{
+			AddResource(InheritedStyle);
+		}
+	}
+}
@@ -1,6 +1,7 @@
 // Copyright 2022 Guganana. All Rights Reserved.
 #include "Subsystems/ExpressiveTextSubsystem.h"
 
+#include "ExpressiveText/Public/Asset/ExpressiveTextAsset.h"
 #include "ExpressiveText/Public/ExpressiveTextSettings.h"
 #include "ExpressiveText/Public/Styles/ExpressiveTextStyleBase.h"
 
@@ -21,6 +22,104 @@ TOptional<TFuture<UExpressiveTextFont*>>  UExpressiveTextSubsystem::FetchFont(co
 	return FetchResult;
 }
 
+TFuture<void> UExpressiveTextSubsystem::PreloadManifest(const FExpressiveTextResourceManifest& Manifest, TSharedPtr<FStreamableHandle>& OutHandle)
+{
+	OutHandle.Reset();
+
+	TArray<FSoftObjectPath> PathsToLoad;
+	Manifest.GatherSoftObjectPaths(PathsToLoad);
+	PathsToLoad.RemoveAll([](const FSoftObjectPath& Path) { return Path.ResolveObject() != nullptr; });
+
+	if (PathsToLoad.Num() == 0)
+	{
+		return Guganana::Async::MakeFullfiledFuture();
+	}
+
+	TSharedRef<TPromise<void>> Result = MakeShareable(new TPromise<void>());
+	TSharedRef<bool> Fulfilled = MakeShareable(new bool(false));
+	const auto OnLoaded = [Result, Fulfilled]()
+	{
+		if (!Fulfilled.Get())
+		{
+			Fulfilled.Get() = true;
+			Result->SetValue();
+		}
+	};
+
+	OutHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(PathsToLoad, FStreamableDelegate::CreateLambda(OnLoaded));
+	if (!OutHandle.IsValid() || OutHandle->HasLoadCompleted() || OutHandle->WasCanceled())
+	{
+		OnLoaded();
+	}
+	else
+	{
+		// Waiters are resolved whichever way the load ends, assets that failed to load are reported when they are fetched
+		OutHandle->BindCancelDelegate(FStreamableDelegate::CreateLambda(OnLoaded));
+	}
+
+	return Result->GetFuture();
+}
+
+TFuture<void> UExpressiveTextSubsystem::WarmTexts(const TArray<UExpressiveTextAsset*>& Assets)
+{
+	FExpressiveTextResourceManifest CombinedManifest;
+
+	for (const auto* Asset : Assets)
+	{
+		if (Asset)
+		{
+			CombinedManifest.Append(Asset->Fields.ResourceManifest);
+		}
+	}
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	TFuture<void> Result = PreloadManifest(CombinedManifest, LoadHandle);
+
+	if (LoadHandle.IsValid())
+	{
+		WarmedHandles.Add(LoadHandle);
+	}
+
+	return Result;
+}
+
+void UExpressiveTextSubsystem::ReleaseWarmedResources()
+{
+	for (const auto& Handle : WarmedHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->ReleaseHandle();
+		}
+	}
+
+	WarmedHandles.Empty();
+
+	// Values only referenced by the table go with the next garbage collection, the ones still in use are interned again on request
+	InternedValuesLookup.Empty();
+}
+
+void UExpressiveTextSubsystem::TryPurgeInternedValues()
+{
+	static constexpr double InternPurgeInterval = 5.0;
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastInternPurgeTimestamp < InternPurgeInterval)
+	{
+		return;
+	}
+
+	LastInternPurgeTimestamp = CurrentTime;
+
+	for (auto It = InternedValuesLookup.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
 const FColor* UExpressiveTextSubsystem::FetchColorForTag( const FName& Tag ) const
 {
 	return ColorMap.Find(Tag);
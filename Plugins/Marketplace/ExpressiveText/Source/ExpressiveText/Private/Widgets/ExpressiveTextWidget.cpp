@@ -30,6 +30,58 @@ void UExpressiveTextWidget::DisplayText(FExpressiveText& Text)
 	Renderer->SetExpressiveText(Text);
 }
 
+void UExpressiveTextWidget::AppendText(FExpressiveText& Text, const FString& NewLines)
+{
+	if (!Renderer)
+	{
+		EXTEXT_LOG(Error, TEXT("Failed to fetch ExpressiveTextRendererWidget"));
+		return;
+	}
+
+	Renderer->AppendExpressiveText(Text, NewLines);
+}
+
+void UExpressiveTextWidget::SetTemplateValue(FExpressiveText& Text, FName Key, const FString& Value)
+{
+	if (!Renderer)
+	{
+		EXTEXT_LOG(Error, TEXT("Failed to fetch ExpressiveTextRendererWidget"));
+		return;
+	}
+
+	Renderer->SetTemplateValue(Text, Key, Value);
+}
+
 void UExpressiveTextWidget::Clear()
 {
+	SetHoveredGlyph(FExpressiveTextGlyphInformation());
+}
+
+FReply UExpressiveTextWidget::NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	if (Renderer && OnGlyphHovered.IsBound())
+	{
+		FExpressiveTextGlyphInformation Glyph;
+		Renderer->FindGlyphAt(InMouseEvent.GetScreenSpacePosition(), Glyph);
+		SetHoveredGlyph(Glyph);
+	}
+
+	return Super::NativeOnMouseMove(InGeometry, InMouseEvent);
+}
+
+void UExpressiveTextWidget::NativeOnMouseLeave(const FPointerEvent& InMouseEvent)
+{
+	SetHoveredGlyph(FExpressiveTextGlyphInformation());
+	Super::NativeOnMouseLeave(InMouseEvent);
+}
+
+void UExpressiveTextWidget::SetHoveredGlyph(const FExpressiveTextGlyphInformation& Glyph)
+{
+	if (HoveredGlyph.IsSameGlyph(Glyph))
+	{
+		return;
+	}
+
+	HoveredGlyph = Glyph;
+	OnGlyphHovered.Broadcast(HoveredGlyph);
 }
@@ -11,6 +11,7 @@
 #include <Curves/CurveLinearColor.h>
 #include <Curves/CurveFloat.h>
 #include <Engine/DataAsset.h>
+#include <Engine/Texture2D.h>
 #include <Fonts/SlateFontInfo.h>
 #include <GenericPlatform/GenericPlatformMath.h>
 #include <Misc/EngineVersionComparison.h>
@@ -245,7 +246,65 @@ public:
         return Curve->FloatCurves[AxisIndex];
     }
 
-    
+    // Bakes the curves a material can evaluate per glyph into a float texture, one sample column per step of normalized time:
+    // row 0 = (Position.X, Position.Y, Scale, Opacity), row 1 = Color
+    UTexture2D* GetBakedCurvesTexture()
+    {
+#if WITH_EDITOR
+        // Curve assets are edited on their own so the animation isn't told about it, the texture is baked again once they change
+        const uint32 CurvesHash = HashBakedCurves();
+        if (BakedCurvesHash != CurvesHash)
+        {
+            BakedCurvesHash = CurvesHash;
+            BakedCurvesTexture = nullptr;
+        }
+#endif
+
+        if (BakedCurvesTexture)
+        {
+            return BakedCurvesTexture;
+        }
+
+        static constexpr int32 NumSamples = 64;
+        static constexpr int32 NumRows = 2;
+
+        TArray<FLinearColor> Texels;
+        Texels.SetNumUninitialized(NumSamples * NumRows);
+
+        const float Duration = GetAnimationDuration();
+        for (int32 Sample = 0; Sample < NumSamples; Sample++)
+        {
+            const float Time = Duration * Sample / (NumSamples - 1);
+            const FVector EvaluatedPos = Position ? Position->GetVectorValue(Time) : FVector::ZeroVector;
+
+            Texels[Sample] = FLinearColor(
+                EvaluatedPos.X,
+                EvaluatedPos.Y,
+                Scale ? Scale->GetFloatValue(Time) : 1.f,
+                Opacity ? Opacity->GetFloatValue(Time) : 1.f
+            );
+            Texels[NumSamples + Sample] = Color ? Color->GetLinearColorValue(Time) : FLinearColor::White;
+        }
+
+        BakedCurvesTexture = UTexture2D::CreateTransient(NumSamples, NumRows, PF_A32B32G32R32F);
+        BakedCurvesTexture->SRGB = false;
+        BakedCurvesTexture->Filter = TF_Bilinear;
+        BakedCurvesTexture->AddressX = TA_Clamp;
+        BakedCurvesTexture->AddressY = TA_Clamp;
+
+#if UE_VERSION_OLDER_THAN( 5, 0, 0 )
+        FTexture2DMipMap& Mip = BakedCurvesTexture->PlatformData->Mips[0];
+#else
+        FTexture2DMipMap& Mip = BakedCurvesTexture->GetPlatformData()->Mips[0];
+#endif
+        void* MipData = Mip.BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(MipData, Texels.GetData(), Texels.Num() * sizeof(FLinearColor));
+        Mip.BulkData.Unlock();
+
+        BakedCurvesTexture->UpdateResource();
+        return BakedCurvesTexture;
+    }
+
 	UPROPERTY( BlueprintReadWrite, EditAnywhere, Category = AnimationFlags, Meta = (Bitmask, BitmaskEnum = "/Script/ExpressiveText.EExTextAnimationFlags") )
 	int32 AnimationFlags;
 
@@ -300,7 +359,61 @@ public:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = BackgroundBlurAmount)
     UCurveFloat* BackgroundBlurAmount;
 
+    UPROPERTY(Transient)
+    UTexture2D* BakedCurvesTexture;
+
+#if WITH_EDITOR
+    uint32 BakedCurvesHash = 0;
+
+    static uint32 HashRichCurve(const FRichCurve& Curve, uint32 Hash)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Curve.DefaultValue));
+        for (const FRichCurveKey& Key : Curve.GetConstRefOfKeys())
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Key.Time));
+            Hash = HashCombine(Hash, GetTypeHash(Key.Value));
+            Hash = HashCombine(Hash, GetTypeHash(Key.ArriveTangent));
+            Hash = HashCombine(Hash, GetTypeHash(Key.LeaveTangent));
+            Hash = HashCombine(Hash, GetTypeHash((uint8)Key.InterpMode));
+        }
+        return Hash;
+    }
+
+    // Covers the curves baked by GetBakedCurvesTexture
+    uint32 HashBakedCurves() const
+    {
+        uint32 Hash = 0;
+
+        if (Position)
+        {
+            for (const FRichCurve& Curve : Position->FloatCurves)
+            {
+                Hash = HashRichCurve(Curve, Hash);
+            }
+        }
+
+        Hash = Scale ? HashRichCurve(Scale->FloatCurve, Hash) : HashCombine(Hash, 1);
+        Hash = Opacity ? HashRichCurve(Opacity->FloatCurve, Hash) : HashCombine(Hash, 2);
+
+        if (Color)
+        {
+            for (const FRichCurve& Curve : Color->FloatCurves)
+            {
+                Hash = HashRichCurve(Curve, Hash);
+            }
+        }
+
+        return Hash;
+    }
+#endif
+
 #if WITH_EDITOR
+    virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override
+    {
+        Super::PostEditChangeProperty(PropertyChangedEvent);
+        BakedCurvesTexture = nullptr;
+    }
+
     UFUNCTION(BlueprintCallable, Category = ExTextAnimation)
     void OpenCurveAsset(const FName& CurveName )
     {
@@ -95,6 +95,8 @@ public:
 
 };
 
+DECLARE_DYNAMIC_DELEGATE(FOnExpressiveTextResourcesWarmed);
+
 UCLASS()
 class UExpressiveTextFunctions : public UBlueprintFunctionLibrary
 {
@@ -147,6 +149,21 @@ public:
 		return Text;
 	}
 	
+	UFUNCTION(BlueprintCallable, Category = "ExpressiveText")
+	static FExpressiveText& SetMaxHistoryLines(UPARAM(ref) FExpressiveText& Text, int32 MaxHistoryLines)
+	{
+		Text.SetMaxHistoryLines(MaxHistoryLines);
+		return Text;
+	}
+
+	// Long documents only create runs for the lines around the visible part of the widget, meant for texts inside scroll boxes
+	UFUNCTION(BlueprintCallable, Category = "ExpressiveText")
+	static FExpressiveText& SetVirtualized(UPARAM(ref) FExpressiveText& Text, bool Virtualized)
+	{
+		Text.SetVirtualized(Virtualized);
+		return Text;
+	}
+
 	UFUNCTION(BlueprintPure, Category = "ExpressiveText")
 	static const FExpressiveTextFields& GetFields(UPARAM(ref) FExpressiveText& Text)
 	{
@@ -183,6 +200,12 @@ public:
 		return Text.GetWordAtLocation(Location, Scaling);
 	}
 
+	UFUNCTION(BlueprintPure, Category = "ExpressiveText")
+	static bool FindGlyphAtLocation(UPARAM(ref) FExpressiveText& Text, FVector2D Location, FExpressiveTextGlyphInformation& OutGlyph, float Scaling = 1.f)
+	{
+		return Text.FindGlyphAtLocation(Location, Scaling, OutGlyph);
+	}
+
 	UFUNCTION(BlueprintPure, Category = "ExpressiveText")
 	static const FVector2D GetBoxSize(UPARAM(ref) FExpressiveText& Text)
 	{
@@ -208,6 +231,12 @@ public:
 	}
 
 
+	UFUNCTION(BlueprintCallable, Category = "ExpressiveText")
+	static void WarmResources(const TArray<UExpressiveTextAsset*>& Assets, FOnExpressiveTextResourcesWarmed OnWarmed);
+
+	UFUNCTION(BlueprintCallable, Category = "ExpressiveText")
+	static void ReleaseWarmedResources();
+
 	UFUNCTION(BlueprintPure, Category = "ExpressiveText")
 	static int64 CalcSelectorChecksum(UPARAM(ref) FExpressiveTextSelector& Selector)
 	{
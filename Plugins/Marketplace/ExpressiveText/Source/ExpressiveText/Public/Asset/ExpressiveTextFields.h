@@ -8,6 +8,8 @@
 #include "Compiled/ExTextContext.h"
 #include "Layout/ExpressiveTextAlignment.h"
 #include "Layout/ExpressiveTextWrapSettings.h"
+#include "Resources/ExpressiveTextResourceManifest.h"
+#include "Styles/ExpressiveTextStyleBase.h"
 #include <Misc/EngineVersionComparison.h>
 
 #include <Framework/Text/TextLayout.h>
@@ -34,6 +36,7 @@ struct FExpressiveTextFields
         , DefaultStyle()
         , Actions()
         , ReferencedResources()
+        , ResourceManifest()
 		, AliveHandle ( MakeShareable( new int32(1) ) )
     {
     }
@@ -51,6 +54,8 @@ struct FExpressiveTextFields
 		Result = HashCombine(Result, GetTypeHash(Text.ToString()));
 		Result = HashCombine(Result, GetTypeHash(Justification));
 		Result = HashCombine(Result, GetTypeHash(DefaultStyle));
+		// The style's parameters are refilled in place when it or a style it inherits from is edited
+		Result = HashCombine(Result, DefaultStyle ? GetTypeHash(DefaultStyle->GetVersion()) : 0);
 		Result = HashCombine(Result, GetTypeHash(DefaultFontSize));
 		Result = HashCombine(Result, GetTypeHash(UseDefaultFontSize));
 		return Result;
@@ -86,6 +91,9 @@ struct FExpressiveTextFields
     UPROPERTY( VisibleAnywhere, BlueprintReadOnly, Category = ExpressiveText )
     TArray< UObject* > ReferencedResources;
 
+    UPROPERTY( VisibleAnywhere, BlueprintReadOnly, Category = ExpressiveText )
+    FExpressiveTextResourceManifest ResourceManifest;
+
 	TWeakPtr<int32> GetAliveHandle() const
 	{
 		return AliveHandle;
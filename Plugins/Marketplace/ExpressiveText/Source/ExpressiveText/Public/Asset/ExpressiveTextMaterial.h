@@ -21,6 +21,7 @@ enum class EExTextDynamicMaterialParameters : int32
     RevealAndClearInformation = 2,
     LineIndex = 4,
     BlockSizeAndTopLeftPosition = 8,
+    GlyphAnimation = 16,
 };
 
 UCLASS()
@@ -0,0 +1,109 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Tickable.h>
+
+#include "CompiledExpressiveText.h"
+#include "../Handles/ExpressiveText.h"
+
+class FExpressiveTextCompiler;
+
+// Order in which queued compiles are worked on, higher first
+enum class EExTextCompilePriority : uint8
+{
+	Background,
+	Visible,
+	Focused,
+	// Skips the queue and compiles within the call regardless of the budget, for tooling that needs the result right away
+	Immediate
+};
+
+struct FExTextCompileSchedulerStats
+{
+	FExTextCompileSchedulerStats()
+		: QueueDepth(0)
+		, MaxQueueDepth(0)
+		, CompletedJobs(0)
+		, AverageLatency(0.0)
+		, MaxLatency(0.0)
+		, LastFrameTime(0.0)
+		, DeferredFrames(0)
+	{}
+
+	// Compiles queued or in progress
+	int32 QueueDepth;
+	int32 MaxQueueDepth;
+	int32 CompletedJobs;
+	// Seconds between queueing a compile and its result being ready
+	double AverageLatency;
+	double MaxLatency;
+	// Seconds spent compiling during the last frame that had queued work
+	double LastFrameTime;
+	// Frames that ran out of budget and carried compiles over to the next frame
+	int32 DeferredFrames;
+};
+
+// Spreads text compiles over frames so a burst of texts set at once doesn't hitch.
+// Queued compiles run by priority until UExpressiveTextSettings::CompileBudgetMs is spent for the frame,
+// compiles that didn't finish resume from the same stage on the next frame.
+class EXPRESSIVETEXT_API FExTextCompileScheduler : public FTickableGameObject
+{
+public:
+
+	FExTextCompileScheduler();
+
+	// AppendedLines compiles only those lines on top of the current layout, see FExpressiveTextCompiler::Append
+	TFuture<FCompiledExpressiveText> Enqueue(FExpressiveText ExpressiveText, EExTextCompilePriority Priority, TOptional<FString> AppendedLines = TOptional<FString>());
+
+	const FExTextCompileSchedulerStats& GetStats() const
+	{
+		return Stats;
+	}
+
+	virtual bool IsTickable() const override
+	{
+		return Jobs.Num() > 0;
+	}
+
+	virtual bool IsTickableWhenPaused() const override
+	{
+		return true;
+	}
+
+	virtual bool IsTickableInEditor() const override
+	{
+		return true;
+	}
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FExTextCompileScheduler, STATGROUP_Tickables);
+	}
+
+	virtual void Tick(float DeltaTime) override
+	{
+		RunJobs();
+	}
+
+private:
+
+	struct FJob
+	{
+		TSharedRef<FExpressiveTextCompiler> Compiler;
+		EExTextCompilePriority Priority;
+		double QueuedTime;
+		uint64 Order;
+	};
+
+	void RunJobs();
+
+	TArray<FJob> Jobs;
+	uint64 NextOrder;
+	uint64 BudgetFrame;
+	double BudgetSpent;
+	bool SlicedThisFrame;
+	bool DeferredThisFrame;
+	bool IsRunning;
+	FExTextCompileSchedulerStats Stats;
+};
@@ -46,6 +46,16 @@ namespace ExpressiveTextCompilerFlag
 	EXPRESSIVETEXT_API extern bool SpecialMode;
 }
 
+// Stages of a compile, a sliced compile can stop after any of them and resume on a later frame
+enum class EExTextCompileStage : uint8
+{
+	LoadingResources,
+	ExtractingLines,
+	ResolvingLookups,
+	PopulatingRuns,
+	Finished
+};
+
 // Struct to help with latent steps of text "compilation", more specifically loading required assets
 class FExpressiveTextCompiler : public TSharedFromThis<FExpressiveTextCompiler>
 {
@@ -61,6 +71,14 @@ private:
 		, LinesExtractions()
 		, IsCompiling(false)
 		, DryRun(false)
+		, AppendedText()
+		, LinesGeneration(0)
+		, Sliced(false)
+		, Stage(EExTextCompileStage::LoadingResources)
+		, NextLineToExtract(0)
+		, PendingExtractions()
+		, ResourcesHandle()
+		, KeepAlive()
 	{
 	}
 
@@ -73,6 +91,24 @@ private:
 	TArray<TSharedRef<FExpressiveTextExtraction>> LinesExtractions;
 	bool IsCompiling;
 	bool DryRun;
+
+	// Set when only new lines are compiled and added after the ones already in the layout
+	TOptional<FString> AppendedText;
+
+	// Lines generation of the layout when the compile was requested, resetting the layout makes the compile stale
+	uint32 LinesGeneration;
+
+	// Set when FExTextCompileScheduler drives the compile, lines and runs are then only processed inside CompileSlice
+	bool Sliced;
+	EExTextCompileStage Stage;
+	int32 NextLineToExtract;
+	TArray<TFuture<void>> PendingExtractions;
+
+	// Keeps the resources of the manifest loaded until the runs are populated
+	TSharedPtr<FStreamableHandle> ResourcesHandle;
+
+	// Immediate compiles have no owner, the compiler holds itself until its result is set
+	TSharedPtr<FExpressiveTextCompiler> KeepAlive;
 public:
 
 
@@ -90,38 +126,85 @@ public:
 		check(!IsCompiling);
 		ExpressiveText = InExpressiveText;
 		IsCompiling = true;
+		KeepAlive = AsShared();
+		LinesGeneration = ExpressiveText.GetTextLayout()->GetLinesGeneration();
 
-		const auto& Fields = ExpressiveText.GetFields();
-		TextStringRef = MakeShareable(new FString(Fields.Text.ToString()));
-		TArray<FString> Lines;
-		TextStringRef->ParseIntoArrayLines(Lines, false);
+		TFuture<FCompiledExpressiveText> TextCompiled = OnCompiledText.GetFuture();
 
-		TArray<TFuture<void>> AllExtractionsGenerated;
-		for (int32 i = 0; i < Lines.Num(); i++)
-		{
-			LinesRefs.Emplace(MakeShareable(new FString(Lines[i])));
-			AllExtractionsGenerated.Add(GenerateExtraction(i));
-		}
+		// Load every resource the text is known to need in a single batch so tag lookups resolve from memory
+		auto* ExpressiveTextSubsystem = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>();
+		check(ExpressiveTextSubsystem);
 
-		TFuture<FCompiledExpressiveText> TextCompiled = Guganana::Async::WhenAllFutures(AllExtractionsGenerated).Next(
-			[SharedCompiler = TSharedPtr<FExpressiveTextCompiler>(AsShared())](auto)
+		ExpressiveTextSubsystem->PreloadManifest(ExpressiveText.GetFields().ResourceManifest, ResourcesHandle).Next(
+			[SharedCompiler = AsShared()](auto)
 			{
-				// TODO: SharedCompiler will be destroyed if we don't store the TFuture. 
-				// this needs reworking to avoid that
-				if (FExpressiveTextCompiler* Compiler = SharedCompiler.Get())
+				SharedCompiler->PrepareLines();
+
+				if (!SharedCompiler->Sliced)
 				{
-					SharedCompiler->PopulateRuns();
-					SharedCompiler->OnCompiledText.EmplaceValue(SharedCompiler->TempCompiledText);
-					return SharedCompiler->TempCompiledText;
+					SharedCompiler->ExtractLines(TNumericLimits<double>::Max());
 				}
-
-				return FCompiledExpressiveText();
 			}
 		);
 
 		return TextCompiled;
 	}
 
+	// Compile and Append then only do work inside CompileSlice
+	void EnableSlicing()
+	{
+		check(!IsCompiling);
+		Sliced = true;
+	}
+
+	EExTextCompileStage GetStage() const
+	{
+		return Stage;
+	}
+
+	// False while the compile waits on resources or parameter lookups to load
+	bool CanCompileSlice() const
+	{
+		return Stage == EExTextCompileStage::ExtractingLines || Stage == EExTextCompileStage::PopulatingRuns;
+	}
+
+	// True once the layout was reset for a newer text, the result of this compile would belong to the previous one
+	bool IsStale() const
+	{
+		return ExpressiveText.GetTextLayout()->GetLinesGeneration() != LinesGeneration;
+	}
+
+	// Runs the stages that are ready until EndTime (in FPlatformTime::Seconds).
+	// At least one line is extracted per call so a compile always progresses, the runs of every line are populated at once.
+	void CompileSlice(double EndTime)
+	{
+		check(Sliced);
+
+		// Nothing left to do for a superseded compile, finishing resolves its waiters without touching the layout
+		if (IsStale())
+		{
+			FinishCompile();
+			return;
+		}
+
+		if (Stage == EExTextCompileStage::ExtractingLines)
+		{
+			ExtractLines(EndTime);
+		}
+
+		if (Stage == EExTextCompileStage::PopulatingRuns && FPlatformTime::Seconds() < EndTime)
+		{
+			FinishCompile();
+		}
+	}
+
+	// Compiles NewLines only and adds them to the layout of the text without clearing it, used for streamed text
+	TFuture<FCompiledExpressiveText> Append(FExpressiveText InExpressiveText, const FString& NewLines)
+	{
+		AppendedText = NewLines;
+		return Compile(InExpressiveText);
+	}
+
 	void GetExtractions(FExpressiveText InExpressiveText, TArray<FExpressiveLineExtractionsInfo>& OutLinesExtractionsInfo)
 	{
 		check(!IsCompiling);
@@ -152,7 +235,183 @@ public:
 		OnCompiledText.SetValue(TempCompiledText);
 	}
 
+	// Swaps a template value in the lines already in the layout of Text. The extractions are patched in place and only the lines
+	// holding the value get new runs, so only those are shaped again. The reveal of the following lines moves by however much
+	// longer or shorter the patched lines got, and clear times are evaluated again over the whole layout like a compile does.
+	// Returns false when no line was patched, the text has to be compiled again then.
+	static bool ApplyTemplateValue(const FExpressiveText& Text, const FName& Key, const FString& Value)
+	{
+		TSharedRef<FExpressiveTextSlateLayout> TextLayout = Text.GetTextLayout();
+
+		// Virtual lines outside of the window have no runs to patch
+		if (TextLayout->IsVirtualized())
+		{
+			return false;
+		}
+
+		UObject* WorldContext = Text.GetWorldContext();
+		UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+
+		// How much later (or earlier) the lines after the patched ones finish revealing
+		float RevealShift = 0.f;
+		bool Changed = false;
+
+		const TArray<FTextLayout::FLineModel>& LineModels = TextLayout->GetLineModels();
+		for (int32 LineIndex = 0; LineIndex < LineModels.Num(); LineIndex++)
+		{
+			const FTextLayout::FLineModel& LineModel = LineModels[LineIndex];
+			if (LineModel.Runs.Num() == 0)
+			{
+				continue;
+			}
+
+			const TSharedRef<FExpressiveTextRun> FirstRun = StaticCastSharedRef<FExpressiveTextRun>(LineModel.Runs[0].GetRun());
+			TSharedPtr<FExpressiveTextExtraction> Extraction = FirstRun->GetOwnerExtraction();
+
+			// The current runs keep pointing at the old text until they are released
+			TSharedRef<FString> Line = MakeShareable(new FString(LineModel.Text.Get()));
+			if (!Extraction.IsValid() || !Extraction->HasTemplateSlot(Key) || !Extraction->ApplyTemplateValue(Line.Get(), Key, Value))
+			{
+				if (RevealShift != 0.f)
+				{
+					for (const FTextLayout::FRunModel& RunModel : LineModel.Runs)
+					{
+						StaticCastSharedRef<FExpressiveTextRun>(RunModel.GetRun())->OffsetRevealStartTime(RevealShift);
+					}
+				}
+				continue;
+			}
+
+			const TSharedRef<FExpressiveTextRun> LastRun = StaticCastSharedRef<FExpressiveTextRun>(LineModel.Runs.Last().GetRun());
+			const float OldRevealEndTime = LastRun->GetRevealStartTime() + LastRun->CalculateDurationToFullyReveal();
+
+			float RevealStartTime = FirstRun->GetRevealStartTime() + RevealShift;
+
+			TArray<TSharedRef<FExpressiveTextRun>> Runs;
+			PopulateRunsFromExtraction(World, Line, Extraction.ToSharedRef(), Runs, TextLayout, RevealStartTime);
+
+			// RevealStartTime is now where the patched line finishes revealing
+			RevealShift = RevealStartTime - OldRevealEndTime;
+
+			TArray<TSharedRef<IRun>> CastRuns;
+			for (const TSharedRef<FExpressiveTextRun>& Run : Runs)
+			{
+				CastRuns.Add(Run);
+			}
+
+			TextLayout->ReplaceLine(LineIndex, Line, CastRuns);
+			Changed = true;
+		}
+
+		if (!Changed)
+		{
+			return false;
+		}
+
+		auto& Chronos = TextLayout->GetSharedData()->Chronos;
+		float Chronometer = Chronos.GetRevealDuration() + RevealShift;
+		Chronos.SetRevealDuration(Chronometer);
+
+		TArray<TSharedRef<FExpressiveTextRun>> AllRuns;
+		for (const FTextLayout::FLineModel& LineModel : TextLayout->GetLineModels())
+		{
+			for (const FTextLayout::FRunModel& RunModel : LineModel.Runs)
+			{
+				TSharedRef<FExpressiveTextRun> Run = StaticCastSharedRef<FExpressiveTextRun>(RunModel.GetRun());
+				Run->SetClearStartTime(-1.f);
+				AllRuns.Add(Run);
+			}
+		}
+
+		// Clears start once everything is revealed and follow each other, so every run after a patched one moves
+		EvaluateEndTimesForDirection(AllRuns, EExText_ClearDirection::Forwards, Chronometer);
+		EvaluateEndTimesForDirection(AllRuns, EExText_ClearDirection::Backwards, Chronometer);
+
+		TArray<float> GlyphRevealTimes;
+		for (const auto& Run : AllRuns)
+		{
+			Run->AppendGlyphRevealTimes(GlyphRevealTimes);
+		}
+
+		Chronos.SetGlyphRevealTimes(MoveTemp(GlyphRevealTimes));
+		TextLayout->UpdateLayout();
+
+		return true;
+	}
+
 private:
+	void PrepareLines()
+	{
+		const auto& Fields = ExpressiveText.GetFields();
+		TextStringRef = MakeShareable(new FString(AppendedText.IsSet() ? AppendedText.GetValue() : Fields.Text.ToString()));
+		TArray<FString> Lines;
+		TextStringRef->ParseIntoArrayLines(Lines, false);
+
+		for (int32 i = 0; i < Lines.Num(); i++)
+		{
+			LinesRefs.Emplace(MakeShareable(new FString(Lines[i])));
+		}
+
+		Stage = EExTextCompileStage::ExtractingLines;
+	}
+
+	void ExtractLines(double EndTime)
+	{
+		while (NextLineToExtract < LinesRefs.Num())
+		{
+			PendingExtractions.Add(GenerateExtraction(NextLineToExtract++));
+
+			if (FPlatformTime::Seconds() >= EndTime)
+			{
+				break;
+			}
+		}
+
+		if (NextLineToExtract < LinesRefs.Num())
+		{
+			return;
+		}
+
+		Stage = EExTextCompileStage::ResolvingLookups;
+
+		Guganana::Async::WhenAllFutures(PendingExtractions).Next(
+			[SharedCompiler = AsShared()](auto)
+			{
+				// Already finished when it went stale while extracting
+				if (SharedCompiler->Stage == EExTextCompileStage::Finished)
+				{
+					return;
+				}
+
+				if (SharedCompiler->Sliced)
+				{
+					SharedCompiler->Stage = EExTextCompileStage::PopulatingRuns;
+				}
+				else
+				{
+					SharedCompiler->FinishCompile();
+				}
+			}
+		);
+	}
+
+	void FinishCompile()
+	{
+		// Released once this returns, the compiler may go with it
+		TSharedPtr<FExpressiveTextCompiler> Self = MoveTemp(KeepAlive);
+
+		PopulateRuns();
+		Stage = EExTextCompileStage::Finished;
+
+		if (ResourcesHandle.IsValid())
+		{
+			ResourcesHandle->ReleaseHandle();
+			ResourcesHandle.Reset();
+		}
+
+		OnCompiledText.EmplaceValue(TempCompiledText);
+	}
+
 	TSharedPtr<FExpressiveTextParameterLookup> CreateDefaultParameterLookup(UExpressiveTextStyleBase* CustomDefaultStyle, TOptional<int32> DefaultFontSize = TOptional<int32>())
 	{
 		TSharedPtr<FExpressiveTextParameterLookup> Result;
@@ -176,7 +435,7 @@ private:
 
 		if (DefaultFontSize.IsSet())
 		{
-			TSharedPtr<IExpressiveTextParameterExtractor> FontSizeParameter = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_FontSize>(DefaultFontSize.GetValue());
+			TSharedPtr<IExpressiveTextParameterExtractor> FontSizeParameter = MakeInlineExtractor<UExTextValue_FontSize>(DefaultFontSize.GetValue());
 			TSharedPtr<FExpressiveTextParameterLookup> DefaultFontSizeLookup = MakeShareable(new FExpressiveTextParameterLookup(FName("Fields Default Font Size"), FontSizeParameter));
 			DefaultFontSizeLookup->SetNext(Result);
 			Result = DefaultFontSizeLookup;
@@ -195,6 +454,13 @@ private:
 
 		const FExpressiveTextContext& Context = ExpressiveText.GetContext();
 		auto TextLayout = ExpressiveText.GetTextLayout();
+
+		// The layout was reset while these lines were compiling, they belong to the previous text
+		if (IsStale())
+		{
+			return;
+		}
+
 		TextLayout->SetJustification(Fields.Justification);
 
 		if (ExpressiveTextCompilerFlag::SpecialMode)
@@ -204,18 +470,35 @@ private:
 
 		if (FSlateApplication::IsInitialized())
 		{
-			float Chronometer = 0.f;
+			auto& Chronos = TextLayout->GetSharedData()->Chronos;
+
+			// Appended lines start revealing once the current lines are done, or right away if they already are,
+			// so the lines on screen keep their timing
+			float Chronometer = AppendedText.IsSet() ? FMath::Max3(0.f, Chronos.GetRevealDuration(), Chronos.GetTimePassed()) : 0.f;
 			TArray<TSharedRef<FExpressiveTextRun>> AllRuns;
 			TArray<FTextLayout::FNewLineData> LineDatas;
 
+			const bool Virtualized = ExpressiveText.IsVirtualized() && !AppendedText.IsSet();
+			TArray<FExTextVirtualLine> VirtualLines;
+
 			for ( int LineIndex = 0; LineIndex < LinesRefs.Num(); LineIndex++ )
 			{
 				TSharedRef<FString> Line = LinesRefs[LineIndex];
 				TSharedRef<FExpressiveTextExtraction> LineExtraction = LinesExtractions[LineIndex];
 
+				if (Virtualized)
+				{
+					VirtualLines.Emplace(Line, LineExtraction, Chronometer);
+				}
+
 				TArray<TSharedRef<FExpressiveTextRun>> Runs;
 				PopulateRunsFromExtraction(World, Line, LineExtraction, Runs, TextLayout, Chronometer);
 
+				if (Virtualized)
+				{
+					VirtualLines.Last().Runs = Runs;
+				}
+
 				TArray<TSharedRef<IRun>> CastRuns;
 				for (auto& Run : Runs)
 				{
@@ -226,13 +509,61 @@ private:
 				LineDatas.Add(FTextLayout::FNewLineData(Line, CastRuns));
 			}
 
+			Chronos.SetRevealDuration(Chronometer);
+
 			EvaluateEndTimesForDirection(AllRuns, EExText_ClearDirection::Forwards, Chronometer);
 			EvaluateEndTimesForDirection(AllRuns, EExText_ClearDirection::Backwards, Chronometer);
 
-			TextLayout->AddLines(LineDatas);
+			TArray<float> GlyphRevealTimes;
+			for (const auto& Run : AllRuns)
+			{
+				Run->AppendGlyphRevealTimes(GlyphRevealTimes);
+			}
+
+			if (AppendedText.IsSet())
+			{
+				Chronos.AppendGlyphRevealTimes(MoveTemp(GlyphRevealTimes));
+				TextLayout->AddLines(LineDatas);
+
+				TArray<float> RemovedGlyphRevealTimes;
+				TextLayout->TrimFrontLines(ExpressiveText.GetMaxHistoryLines(), RemovedGlyphRevealTimes);
+				Chronos.RemoveGlyphRevealTimes(RemovedGlyphRevealTimes);
+			}
+			else if (Virtualized)
+			{
+				Chronos.SetGlyphRevealTimes(MoveTemp(GlyphRevealTimes));
+
+				// Clear times are evaluated over the whole document, keep them for when the runs are created again
+				for (FExTextVirtualLine& VirtualLine : VirtualLines)
+				{
+					for (const auto& Run : VirtualLine.Runs)
+					{
+						VirtualLine.RunClearStartTimes.Add(Run->GetClearStartTime());
+					}
+				}
+
+				TWeakPtr<FExpressiveTextSlateLayout> WeakTextLayout = TextLayout;
+				TWeakObjectPtr<UWorld> WeakWorld = World;
+				TextLayout->SetVirtualLines(MoveTemp(VirtualLines),
+					[WeakTextLayout, WeakWorld](const FExTextVirtualLine& VirtualLine, TArray<TSharedRef<FExpressiveTextRun>>& OutRuns)
+					{
+						if (TSharedPtr<FExpressiveTextSlateLayout> PinnedTextLayout = WeakTextLayout.Pin())
+						{
+							float RevealStartTime = VirtualLine.RevealStartTime;
+							PopulateRunsFromExtraction(WeakWorld.Get(), VirtualLine.Text, VirtualLine.Extraction, OutRuns, PinnedTextLayout.ToSharedRef(), RevealStartTime);
+						}
+					}
+				);
+			}
+			else
+			{
+				Chronos.SetGlyphRevealTimes(MoveTemp(GlyphRevealTimes));
+				TextLayout->AddLines(LineDatas);
+			}
+
 			TextLayout->UpdateLayout();
 
-			const FVector2D TextSize = TextLayout->GetDrawSize();
+			const FVector2D TextSize = TextLayout->IsVirtualized() ? TextLayout->GetVirtualSize() : TextLayout->GetDrawSize();
 			TempCompiledText.DrawSize = TextSize;
 			TempCompiledText.Alignment = Fields.Alignment;
 			TempCompiledText.WrapSettings = Fields.WrapSettings;
@@ -241,7 +572,7 @@ private:
 	}
 
 
-	FSlateFontInfo GetFontInfoFromLookup(const TSharedPtr<FExpressiveTextParameterLookup>& Lookup)
+	static FSlateFontInfo GetFontInfoFromLookup(const TSharedPtr<FExpressiveTextParameterLookup>& Lookup)
 	{
 		if (auto* Font = Lookup->GetValue<UExTextValue_Font>())
 		{
@@ -269,20 +600,24 @@ private:
 	}
 
 
-	void PopulateRunsFromExtraction(UWorld* World, TSharedRef<FString> TextAsStringRef, TSharedRef<FExpressiveTextExtraction> Extraction, TArray<TSharedRef<FExpressiveTextRun>>& Runs, TSharedRef<FExpressiveTextSlateLayout> Layout, float& RevealStartTimer)
+	// Static so virtualized layouts can create the runs of a line again when it scrolls into view
+	static void PopulateRunsFromExtraction(UWorld* World, TSharedRef<FString> TextAsStringRef, TSharedRef<FExpressiveTextExtraction> Extraction, TArray<TSharedRef<FExpressiveTextRun>>& Runs, TSharedRef<FExpressiveTextSlateLayout> Layout, float& RevealStartTimer)
 	{
 		auto SharedData = Layout->GetSharedData();
 
-		const auto AddRun = [this, &World, &RevealStartTimer, &Runs, &Extraction, &TextAsStringRef, &SharedData, &Layout](const TSharedPtr<FExpressiveTextParameterLookup>& Lookup, const FTextRange& Range, const TArray<FExText_ParsedInterjection>& Interjections)
+		const auto AddRun = [&World, &RevealStartTimer, &Runs, &Extraction, &TextAsStringRef, &SharedData, &Layout](const TSharedPtr<FExpressiveTextParameterLookup>& Lookup, const FTextRange& Range, const TArray<FExText_ParsedInterjection>& Interjections)
 		{
 			if (Lookup->GetValue<UExTextValue_ForceFullTextShapingMethod>())
 			{
 				Layout->SetTextShapingMethod(ETextShapingMethod::FullShaping);
 			}
 
+			// When animations are evaluated by the material the run can stay whole and be submitted as a single batch
+			const bool EvaluateAnimationOnGPU = FExpressiveTextRun::CanEvaluateAnimationOnGPU(*Lookup, Interjections.Num() > 0);
+
 			const bool DrawEachGlyphSeperately =
-				(Lookup->GetValue<UExTextValue_RevealAnimation>().Animation != nullptr && Lookup->GetValue<UExTextValue_RevealRate>() > 0.f) ||
-				(Lookup->GetValue<UExTextValue_ClearAnimation>().Animation != nullptr && Lookup->GetValue<UExTextValue_ClearRate>() > 0.f) ||
+				(!EvaluateAnimationOnGPU && Lookup->GetValue<UExTextValue_RevealAnimation>().Animation != nullptr && Lookup->GetValue<UExTextValue_RevealRate>() > 0.f) ||
+				(!EvaluateAnimationOnGPU && Lookup->GetValue<UExTextValue_ClearAnimation>().Animation != nullptr && Lookup->GetValue<UExTextValue_ClearRate>() > 0.f) ||
 				Lookup->GetValue<UExTextValue_ForceDrawEachGlyphSeparately>();
 
 			// separate each character to a different run so it can apply per character animations
@@ -304,6 +639,7 @@ private:
 					const TSharedRef<FExpressiveTextRun> Run = FExpressiveTextSlateLayout::CreateRun(TextAsStringRef, GetFontInfoFromLookup(Lookup), FTextRange(i, i + 1), SharedData, RevealStartTimer);
 					Run->SetParameterLookup(Lookup);
 					Run->SetOwnerExtraction(Extraction);
+					Run->SetSourceRange(Range);
 					Run->SetInterjections(InterjectionForThisGlyph);
 					Run->SetWorld(World);
 					Runs.Add(Run);
@@ -348,8 +684,6 @@ private:
 				AddRun(TreeExtraction.ParameterLookup, Range, ParsedInterjections);
 			}
 		);
-
-		SharedData->Chronos.SetRevealDuration(RevealStartTimer);
 	}
 
 
@@ -454,7 +788,7 @@ private:
 		}
 	}
 
-	void EvaluateEndTimesForDirection(TArray<TSharedRef<FExpressiveTextRun>>& Runs, EExText_ClearDirection ClearDirection, float& Choronometer)
+	static void EvaluateEndTimesForDirection(TArray<TSharedRef<FExpressiveTextRun>>& Runs, EExText_ClearDirection ClearDirection, float& Choronometer)
 	{
 		int32 RunsNum = Runs.Num();
 
@@ -577,6 +911,11 @@ private:
 			RemovedCount += Count;
 		};
 
+		const auto Insert = [&](int32 Start, const FString& Text) {
+			Line.InsertAt(Start, Text);
+			RemovedCount -= Text.Len();
+		};
+
 		TArray<TFuture<void>> AllLookupFuturesComplete;
 
 		static const int32 UnicodeTokenLength = 7;
@@ -665,8 +1004,8 @@ private:
 					ExtractionBeingClosed->Range.EndIndex = ContentEndIndex;
 					Remove(ContentEndIndex, 1);
 
-					// Only when content is present
-					if (ContentEndIndex > ExtractionBeingClosed->Range.BeginIndex)
+					// Only when content is present, or a template value may fill it later
+					if (ContentEndIndex > ExtractionBeingClosed->Range.BeginIndex || Extraction->HoldsTemplateSlot(*ExtractionBeingClosed))
 					{
 						ExtractionBeingClosed->Content = Line.Mid(ExtractionBeingClosed->Range.BeginIndex, ExtractionBeingClosed->Range.Len() - 1);
 						AddExtractionToParent(ExtractionBeingClosed);
@@ -718,6 +1057,30 @@ private:
 					Next();
 				}
 			}
+			else if (IsCurrent('{'))
+			{
+				Next();
+				if (IsCurrent('}'))
+				{
+					int32 SlotStart = CharacterRealPositionFromIndex(CurrentIndex - 1);
+					int32 SlotEnd = CharacterRealPositionFromIndex(CurrentIndex);
+
+					const FName Key(*Line.Mid(SlotStart + 1, SlotEnd - SlotStart - 1));
+					const FString Value = ExpressiveText.GetTemplateDictionary().FindRef(Key);
+
+					// Tokens were parsed before the value went in so any markup inside it stays as plain text
+					Remove(SlotStart, SlotEnd - SlotStart + 1);
+					Insert(SlotStart, Value);
+
+					FExTextTemplateSlot& Slot = Extraction->TemplateSlots.AddDefaulted_GetRef();
+					Slot.Key = Key;
+					Slot.Range = FTextRange(SlotStart, SlotStart + Value.Len());
+					Slot.Owner = GetParent();
+					Slot.InterjectionsBefore = Extraction->Interjections.Num();
+
+					Next();
+				}
+			}
 			else
 			{
 				Next();
@@ -743,8 +1106,42 @@ private:
 	{
 		static TArray<TCHAR> ReservedCharacters = { '[', ']', '(', ')', '<', '>', '/' };
 
+		const TMap<FName, FString>& TemplateDictionary = ExpressiveText.GetTemplateDictionary();
+
+		// Depth of the tag names ([...]) and interjections (<...>) being parsed
+		int32 TagDepth = 0;
+		int32 InterjectionDepth = 0;
+
 		for (int i = 0; i < String.Len(); i++)
 		{
+			// Braces are only markup around a key of the template dictionary, any other braces are plain text.
+			// Placeholders are only replaced in content, not inside tags or interjections.
+			if (String[i] == '{' && TemplateDictionary.Num() > 0 && TagDepth == 0 && InterjectionDepth == 0)
+			{
+				const int32 KeyEnd = FindFromIndex(String, '}', i + 1);
+				if (KeyEnd != INDEX_NONE && TemplateDictionary.Contains(FName(*String.Mid(i + 1, KeyEnd - i - 1))))
+				{
+					if (i > 0 && String[i - 1] == '\\')
+					{
+						FExTextTokenPosition Char;
+						Char.Position = i - 1;
+						OutTokens.Emplace(Char);
+						continue;
+					}
+
+					FExTextTokenPosition OpenToken;
+					OpenToken.Position = i;
+					OutTokens.Emplace(OpenToken);
+
+					FExTextTokenPosition CloseToken;
+					CloseToken.Position = KeyEnd;
+					OutTokens.Emplace(CloseToken);
+
+					i = KeyEnd;
+					continue;
+				}
+			}
+
 			if (ReservedCharacters.Contains(String[i]))
 			{
 				if (i > 0)
@@ -761,12 +1158,29 @@ private:
 				FExTextTokenPosition Token;
 				Token.Position = i;
 				OutTokens.Emplace(Token);
+
+				switch (String[i])
+				{
+				case '[': TagDepth++; break;
+				case ']': TagDepth = FMath::Max(TagDepth - 1, 0); break;
+				case '<': InterjectionDepth++; break;
+				case '>': InterjectionDepth = FMath::Max(InterjectionDepth - 1, 0); break;
+				default: break;
+				}
 			}
 		}
 	}
 
 
+	// Inline tag values are interned by the subsystem so repeated tags across compiles share the same parameter object
+	template< typename ValueObjectType, typename ValueType = typename ValueObjectType::ValueType >
+	static TSharedPtr<IExpressiveTextParameterExtractor> MakeInlineExtractor(const ValueType& Value)
+	{
+		auto* ExpressiveTextSubsystem = GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>();
+		check(ExpressiveTextSubsystem);
 
+		return MakeShareable(new FExpressiveTextInlineParameterExtractor(ExpressiveTextSubsystem->InternParameterValue<ValueObjectType>(Value)));
+	}
 
 	TFuture<TSharedPtr<FExpressiveTextParameterLookup>> MakeLookupFromTag(const FString& Tag)
 	{
@@ -801,7 +1215,7 @@ private:
 
 		if (FirstToken == '#')
 		{
-			TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_FontColor>(FLinearColor(FColor::FromHex(Tag)));
+			TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_FontColor>(FLinearColor(FColor::FromHex(Tag)));
 			return MakeFullfiledExtractorFuture(InlineExtractor);
 		}
 
@@ -818,7 +1232,7 @@ private:
 					[FontName, Handle=AsShared()](UExpressiveTextFont* Font)
 					{
 						Handle->TempCompiledText.HarvestedResources.Add(Font);
-						TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_Font>(Font);
+						TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_Font>(Font);
 						TSharedPtr<FExpressiveTextParameterLookup> Lookup = MakeShareable(new FExpressiveTextParameterLookup(FontName, InlineExtractor));
 						return Lookup;
 					}
@@ -840,7 +1254,7 @@ private:
 					[AnimationName, Handle=AsShared()](UExpressiveTextAnimation* Animation)
 					{
 						Handle->TempCompiledText.HarvestedResources.Add(Animation);
-						TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_RevealAnimation>(FExText_GlyphAnimation(Animation));
+						TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_RevealAnimation>(FExText_GlyphAnimation(Animation));
 						TSharedPtr<FExpressiveTextParameterLookup> Lookup = MakeShareable(new FExpressiveTextParameterLookup(AnimationName, InlineExtractor));
 						return Lookup;
 					}
@@ -856,7 +1270,7 @@ private:
 			FString MutatedTag = Tag;
 			MutatedTag.RemoveAt(0, 1);
 
-			TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_Typeface>(FName(*MutatedTag));
+			TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_Typeface>(FName(*MutatedTag));
 			return MakeFullfiledExtractorFuture(InlineExtractor);
 		}
 
@@ -867,7 +1281,7 @@ private:
 			int32 ParsedFontSize = FCString::Atoi(*MutatedTag);
 			if (ParsedFontSize > 0)
 			{
-				TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_FontSize>(ParsedFontSize);
+				TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_FontSize>(ParsedFontSize);
 				return MakeFullfiledExtractorFuture(InlineExtractor);
 			}
 
@@ -881,7 +1295,7 @@ private:
 			int32 ParsedFontSize = FCString::Atoi(*MutatedTag);
 			if (ParsedFontSize > 0)
 			{
-				TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_RevealRate>(ParsedFontSize);
+				TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_RevealRate>(ParsedFontSize);
 				return MakeFullfiledExtractorFuture(InlineExtractor);
 			}
 
@@ -890,7 +1304,7 @@ private:
 
 		if (const FColor* TagAsColor = ExpressiveTextSubsystem->FetchColorForTag(FName(*Tag)))
 		{
-			TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = FExpressiveTextInlineParameterExtractor::Create<UExTextValue_FontColor>(FLinearColor(*TagAsColor));
+			TSharedPtr<IExpressiveTextParameterExtractor> InlineExtractor = MakeInlineExtractor<UExTextValue_FontColor>(FLinearColor(*TagAsColor));
 			return MakeFullfiledExtractorFuture(InlineExtractor);
 		}
 
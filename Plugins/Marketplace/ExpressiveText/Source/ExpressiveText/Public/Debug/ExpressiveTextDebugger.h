@@ -99,6 +99,10 @@ public:
     UPROPERTY( BlueprintReadOnly, Category = ExpressiveText )
     TArray<FExText_ColoredMessage> Logs;
 
+    // Allocation and cache counters gathered from the subsystem
+    UPROPERTY( BlueprintReadOnly, Category = ExpressiveText )
+    TArray<FExText_ColoredMessage> RuntimeStats;
+
 protected:
 
     virtual void BeginPlay() override
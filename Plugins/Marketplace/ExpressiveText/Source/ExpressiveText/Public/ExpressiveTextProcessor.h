@@ -5,6 +5,7 @@
 #include <Kismet/BlueprintFunctionLibrary.h>
 
 #include "Compiled/CompiledExpressiveText.h"
+#include "Compiled/ExTextCompileScheduler.h"
 #include "Handles/ExpressiveText.h"
 
 #include "ExpressiveTextProcessor.generated.h"
@@ -29,6 +30,11 @@ public:
     UFUNCTION( BlueprintCallable, Category = ExpressiveText )
     static void StringIntoLinesArray( const FString& String, TArray<FString>& OutLines );
 
-    static TFuture<FCompiledExpressiveText> CompileText(FExpressiveText ExpressiveText);
+    // Compiles go through the compile scheduler of the subsystem so they are spread over frames by priority
+    static TFuture<FCompiledExpressiveText> CompileText(FExpressiveText ExpressiveText, EExTextCompilePriority Priority = EExTextCompilePriority::Visible);
+    static TFuture<FCompiledExpressiveText> CompileAppendedText(FExpressiveText ExpressiveText, const FString& NewLines, EExTextCompilePriority Priority = EExTextCompilePriority::Visible);
+
+    // Patches a template value into the compiled layout of the text, false when it has to be compiled again instead
+    static bool ApplyTemplateValue(const FExpressiveText& ExpressiveText, const FName& Key, const FString& Value);
 	
 };
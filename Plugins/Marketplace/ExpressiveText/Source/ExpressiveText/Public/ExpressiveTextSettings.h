@@ -27,6 +27,7 @@ class EXPRESSIVETEXT_API UExpressiveTextSettings : public UDeveloperSettings
 		, DebuggerClass(FSoftObjectPath(TEXT("/ExpressiveText/Core/Debug/BP_ExpressiveTextDebugger.BP_ExpressiveTextDebugger_C")))
 		, TagHighlightingColors()
 		, StopShaderPatchPrompts(false)
+		, CompileBudgetMs(4.f)
 	{
 		TagHighlightingColors = {
 			FColor( 240, 128, 128 ),
@@ -101,6 +102,9 @@ public:
 	UPROPERTY( Config, EditDefaultsOnly, BlueprintReadOnly, Category = ExpressiveText )
 	bool RevertShaderPatch;
 
+	UPROPERTY( Config, EditDefaultsOnly, BlueprintReadOnly, Category = ExpressiveText, meta = (ClampMin = "0", Tooltip = "Milliseconds per frame spent compiling texts, texts over the budget finish on the next frames. 0 compiles every text right away." ) )
+	float CompileBudgetMs;
+
 	const UExpressiveTextDefaultStyle* GetDefaultStyle() const
 	{
 		return DefaultStyleAsset.LoadSynchronous();
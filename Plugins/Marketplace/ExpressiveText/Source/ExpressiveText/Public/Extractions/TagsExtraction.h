@@ -21,10 +21,124 @@ struct FExTextTokenPosition
     int32 Position = -1;
 };
 
+// A {Key} placeholder of the template dictionary, the line holds the value in its place
+struct FExTextTemplateSlot
+{
+    FName Key;
+
+    // In processed line coordinates, covers the value currently in the line
+    FTextRange Range;
+
+    // Innermost section the placeholder was written in
+    TSharedPtr<FTreeExtraction> Owner;
+
+    // Interjections parsed before the placeholder, the ones after it move along with the value
+    int32 InterjectionsBefore = 0;
+};
+
 struct FExpressiveTextExtraction 
 {
     TSharedPtr<FTreeExtraction> ExtractionTree;
     TArray<FExText_ParsedInterjection> Interjections;
+    TArray<FExTextTemplateSlot> TemplateSlots;
+
+    bool HasTemplateSlot(const FName& Key) const
+    {
+        return TemplateSlots.ContainsByPredicate([&Key](const FExTextTemplateSlot& Slot) { return Slot.Key == Key; });
+    }
+
+    // Sections holding a placeholder are kept even when the value is empty so a later value has somewhere to go
+    bool HoldsTemplateSlot(const FTreeExtraction& Section) const
+    {
+        for (const FExTextTemplateSlot& Slot : TemplateSlots)
+        {
+            for (const FTreeExtraction* Holder = Slot.Owner.Get(); Holder; Holder = Holder->Parent.Get())
+            {
+                if (Holder == &Section)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Swaps the value of every Key slot in Line, the sections, interjections and slots after each of them are moved by the difference in length.
+    // Returns false when the line didn't change.
+    bool ApplyTemplateValue(FString& Line, const FName& Key, const FString& Value)
+    {
+        bool Changed = false;
+
+        for (int32 SlotIndex = 0; SlotIndex < TemplateSlots.Num(); SlotIndex++)
+        {
+            FExTextTemplateSlot& Slot = TemplateSlots[SlotIndex];
+            if (Slot.Key != Key || FStringView(*Line + Slot.Range.BeginIndex, Slot.Range.Len()).Equals(Value, ESearchCase::CaseSensitive))
+            {
+                continue;
+            }
+
+            const int32 Delta = Value.Len() - Slot.Range.Len();
+            Line.RemoveAt(Slot.Range.BeginIndex, Slot.Range.Len(), false);
+            Line.InsertAt(Slot.Range.BeginIndex, Value);
+            Changed = true;
+
+            if (Delta != 0)
+            {
+                MoveAfterTemplateSlot(SlotIndex, Delta);
+            }
+        }
+
+        return Changed;
+    }
+
+private:
+    void MoveAfterTemplateSlot(int32 SlotIndex, int32 Delta)
+    {
+        FExTextTemplateSlot& Slot = TemplateSlots[SlotIndex];
+
+        TArray<const FTreeExtraction*, TInlineAllocator<8>> Holders;
+        for (const FTreeExtraction* Holder = Slot.Owner.Get(); Holder; Holder = Holder->Parent.Get())
+        {
+            Holders.Add(Holder);
+        }
+
+        // Sections holding the slot grow with it, the ones starting after it move
+        TFunction<void(FTreeExtraction&)> MoveSection = [&](FTreeExtraction& Section)
+        {
+            if (Holders.Contains(&Section))
+            {
+                Section.Range.EndIndex += Delta;
+            }
+            else if (Section.Range.BeginIndex >= Slot.Range.BeginIndex)
+            {
+                Section.Range.BeginIndex += Delta;
+                Section.Range.EndIndex += Delta;
+            }
+
+            for (const TSharedRef<FTreeExtraction>& Child : Section.Children)
+            {
+                MoveSection(Child.Get());
+            }
+        };
+
+        if (ExtractionTree.IsValid())
+        {
+            MoveSection(*ExtractionTree);
+        }
+
+        for (int32 InterjectionIndex = Slot.InterjectionsBefore; InterjectionIndex < Interjections.Num(); InterjectionIndex++)
+        {
+            Interjections[InterjectionIndex].Index += Delta;
+        }
+
+        for (int32 NextSlotIndex = SlotIndex + 1; NextSlotIndex < TemplateSlots.Num(); NextSlotIndex++)
+        {
+            TemplateSlots[NextSlotIndex].Range.BeginIndex += Delta;
+            TemplateSlots[NextSlotIndex].Range.EndIndex += Delta;
+        }
+
+        Slot.Range.EndIndex += Delta;
+    }
 };
 
 UCLASS()
@@ -22,6 +22,8 @@ struct FExpressiveTextInternal : public FGCObject
 		, CompiledText()
 		, Context()
 		, TextLayout( MakeShareable(new FExpressiveTextSlateLayout) )
+		, MaxHistoryLines( 0 )
+		, Virtualized( false )
 		, Fields()
 #if !UE_VERSION_OLDER_THAN( 5, 4, 0 )
 		, KeepAliveReferences()
@@ -44,6 +46,8 @@ struct FExpressiveTextInternal : public FGCObject
 		Target.CompiledText = CompiledText;
 		Target.Context = Context;
 		Target.TextLayout = TextLayout;
+		Target.MaxHistoryLines = MaxHistoryLines;
+		Target.Virtualized = Virtualized;
 
 		RecollectReferences();
 	}
@@ -76,6 +80,12 @@ struct FExpressiveTextInternal : public FGCObject
 	FExpressiveTextContext Context;
 	TSharedRef<FExpressiveTextSlateLayout> TextLayout;
 
+	// Lines kept when text is streamed in through AppendText, 0 keeps every line
+	int32 MaxHistoryLines;
+
+	// Only the lines around the visible part of the widget get runs, for long documents inside scroll boxes
+	bool Virtualized;
+
 private:
 	FExpressiveTextFields Fields;
 
@@ -97,6 +107,7 @@ struct EXPRESSIVETEXT_API FExpressiveText
 	void SetFields( const FExpressiveTextFields& Fields );
 	void SetAsset(UExpressiveTextAsset* Asset);
 	void SetAsset(UExpressiveTextAsset& Asset);
+	// Values for {Key} placeholders in the text, a compiled text only needs compiling again when a new key is added
 	void AddTemplateValue( const FName& Key, const FString& Value );
 	void SetDefaultStyle( UExpressiveTextStyleBase* Style );
 	void SetCompiledText(const FCompiledExpressiveText& CompiledText);
@@ -108,6 +119,14 @@ struct EXPRESSIVETEXT_API FExpressiveText
 	void SetWrapSettings(const FExpressiveTextWrapSettings& WrapSettings);
 	void DisableDefaultFontSize();
 
+	// Streaming, appended lines are compiled on their own by SExpressiveTextRendererWidget::AppendExpressiveText
+	void AppendText(const FString& NewLines);
+	void SetMaxHistoryLines(int32 MaxHistoryLines);
+	int32 GetMaxHistoryLines() const;
+
+	void SetVirtualized(bool Virtualized);
+	bool IsVirtualized() const;
+
 	FExpressiveText Clone() const;
 
 	// Builders
@@ -127,6 +146,7 @@ struct EXPRESSIVETEXT_API FExpressiveText
 	UExpressiveTextStyleBase* GetDefaultStyle() const;
 	TSharedRef<FExpressiveTextSlateLayout> GetTextLayout() const;
 	const FExpressiveTextContext& GetContext() const;
+	const TMap<FName, FString>& GetTemplateDictionary() const;
 	TOptional<int32> GetDefaultFontSize() const;
 	FVector2D GetSize() const;
 
@@ -224,6 +244,10 @@ struct EXPRESSIVETEXT_API FExpressiveText
 		return Result;
 	}
 
+	// Allocation free alternative to GetChararacterAtLocation and GetWordAtLocation, backed by the glyph table of the layout
+	bool FindGlyphAtLocation(FVector2D Position, float Scaling, FExpressiveTextGlyphInformation& OutGlyph) const;
+	static bool FindGlyphInLayout(const FExpressiveTextSlateLayout& TextLayout, FVector2D Position, float Scaling, FExpressiveTextGlyphInformation& OutGlyph);
+
 	int64 CalcChecksum() const;
 	void SetTextLayout(TSharedRef<FExpressiveTextSlateLayout> InTextLayout);
 	
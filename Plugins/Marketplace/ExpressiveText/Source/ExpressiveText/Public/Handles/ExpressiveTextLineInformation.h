@@ -60,3 +60,54 @@ public:
 	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
 	FVector2D WrappedDrawSize;
 };
+
+USTRUCT(BlueprintType)
+struct FExpressiveTextGlyphInformation
+{
+	GENERATED_BODY()
+
+public:
+	FExpressiveTextGlyphInformation()
+		: LineIndex(INDEX_NONE)
+		, CharacterIndex(INDEX_NONE)
+		, WordStart(INDEX_NONE)
+		, WordEnd(INDEX_NONE)
+		, TagStart(INDEX_NONE)
+		, TagEnd(INDEX_NONE)
+		, StyleName()
+	{}
+
+	bool IsValid() const
+	{
+		return LineIndex != INDEX_NONE;
+	}
+
+	bool IsSameGlyph(const FExpressiveTextGlyphInformation& Other) const
+	{
+		return LineIndex == Other.LineIndex && CharacterIndex == Other.CharacterIndex;
+	}
+
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	int32 LineIndex;
+
+	// Index of the character in its line
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	int32 CharacterIndex;
+
+	// Word containing the character, exclusive end. Both equal the character index when it isn't part of a word
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	int32 WordStart;
+
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	int32 WordEnd;
+
+	// Section of the line styled by the same tag, exclusive end
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	int32 TagStart;
+
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	int32 TagEnd;
+
+	UPROPERTY(Category = ExpressiveText, BlueprintReadOnly)
+	FName StyleName;
+};
@@ -3,12 +3,14 @@
 
 #include <CoreMinimal.h>
 
+#include <Algo/BinarySearch.h>
 #include <Kismet/BlueprintFunctionLibrary.h>
 #include <Misc/App.h>
 
 #include "ExTextChronos.generated.h"
 
 DECLARE_DYNAMIC_DELEGATE(FOnTextFullyRevealedDelegate);
+DECLARE_DYNAMIC_DELEGATE(FOnTextRevealMilestoneDelegate);
 	
 USTRUCT( BlueprintType )
 struct FExpressiveTextChronos
@@ -17,6 +19,12 @@ struct FExpressiveTextChronos
 	
 private:
 
+	struct FRevealMilestone
+	{
+		float Progress;
+		FOnTextRevealMilestoneDelegate Delegate;
+	};
+
 	struct FInternal
 	{
 		FInternal()
@@ -26,6 +34,8 @@ private:
 			, PausedTime( 0.0 )
 			, IsPaused( false )
 			, OnTextFullyRevealed()
+			, GlyphRevealTimes()
+			, RevealMilestones()
 		{}
 
 		double CurrentTime;
@@ -36,6 +46,12 @@ private:
 		bool IsPaused;
 
 		TArray<FOnTextFullyRevealedDelegate> OnTextFullyRevealed;
+
+		// Time passed at which each glyph gets revealed, sorted so the revealed count is a binary search
+		TArray<float> GlyphRevealTimes;
+
+		// Sorted by progress, fired from the front
+		TArray<FRevealMilestone> RevealMilestones;
 	};
 
 	TSharedRef<FInternal> Internal;
@@ -55,6 +71,52 @@ public:
 		return Internal->RevealDuration;
 	}
 
+	void SetGlyphRevealTimes(TArray<float> InGlyphRevealTimes)
+	{
+		InGlyphRevealTimes.Sort();
+		Internal->GlyphRevealTimes = MoveTemp(InGlyphRevealTimes);
+	}
+
+	// Times of lines streamed in after the first compile, these usually come after every existing time so no full sort is needed
+	void AppendGlyphRevealTimes(TArray<float> NewGlyphRevealTimes)
+	{
+		NewGlyphRevealTimes.Sort();
+
+		auto& GlyphRevealTimes = Internal->GlyphRevealTimes;
+		const bool KeepsOrder = GlyphRevealTimes.Num() == 0 || NewGlyphRevealTimes.Num() == 0 || GlyphRevealTimes.Last() <= NewGlyphRevealTimes[0];
+		GlyphRevealTimes.Append(NewGlyphRevealTimes);
+
+		if (!KeepsOrder)
+		{
+			GlyphRevealTimes.Sort();
+		}
+	}
+
+	// Times of lines evicted from the front of a streamed text
+	void RemoveGlyphRevealTimes(const TArray<float>& RemovedGlyphRevealTimes)
+	{
+		auto& GlyphRevealTimes = Internal->GlyphRevealTimes;
+		for (float RevealTime : RemovedGlyphRevealTimes)
+		{
+			const int32 Index = Algo::LowerBound(GlyphRevealTimes, RevealTime);
+			if (GlyphRevealTimes.IsValidIndex(Index) && GlyphRevealTimes[Index] == RevealTime)
+			{
+				GlyphRevealTimes.RemoveAt(Index, 1, false);
+			}
+		}
+	}
+
+	int32 GetNumGlyphs() const
+	{
+		return Internal->GlyphRevealTimes.Num();
+	}
+
+	int32 GetNumRevealedGlyphs() const
+	{
+		// A glyph shows once the time passed goes beyond its reveal time, same as the ceil in FExpressiveTextRun::OnPaint
+		return Algo::LowerBound(Internal->GlyphRevealTimes, GetTimePassed());
+	}
+
 	float GetStartTime() const
 	{
 		return Internal->StartTime;
@@ -97,6 +159,29 @@ public:
 
 			Raw.OnTextFullyRevealed.Empty();
 		}
+
+		if (Raw.RevealMilestones.Num() > 0 && Raw.GlyphRevealTimes.Num() > 0)
+		{
+			const int32 NumRevealedGlyphs = GetNumRevealedGlyphs();
+
+			int32 NumReached = 0;
+			while (NumReached < Raw.RevealMilestones.Num() && FMath::CeilToInt(Raw.RevealMilestones[NumReached].Progress * Raw.GlyphRevealTimes.Num()) <= NumRevealedGlyphs)
+			{
+				NumReached++;
+			}
+
+			if (NumReached > 0)
+			{
+				// Remove before executing in case a delegate binds another milestone
+				TArray<FRevealMilestone> ReachedMilestones(Raw.RevealMilestones.GetData(), NumReached);
+				Raw.RevealMilestones.RemoveAt(0, NumReached);
+
+				for (const auto& Milestone : ReachedMilestones)
+				{
+					Milestone.Delegate.ExecuteIfBound();
+				}
+			}
+		}
 	}
 
 	void SkipToRevealEnd()
@@ -122,6 +207,20 @@ public:
 	{
 		Internal->OnTextFullyRevealed.Add( NewFullyRevealedDelegate );
 	}
+
+	void BindOnRevealMilestone(float Progress, FOnTextRevealMilestoneDelegate NewMilestoneDelegate)
+	{
+		const float ClampedProgress = FMath::Clamp(Progress, 0.f, 1.f);
+		auto& Milestones = Internal->RevealMilestones;
+
+		int32 InsertIndex = Milestones.Num();
+		while (InsertIndex > 0 && Milestones[InsertIndex - 1].Progress > ClampedProgress)
+		{
+			InsertIndex--;
+		}
+
+		Milestones.Insert({ ClampedProgress, NewMilestoneDelegate }, InsertIndex);
+	}
 };
 
 UCLASS()
@@ -172,6 +271,13 @@ public:
 	{
 		Chronos.BindOnTextFullyRevealed(Delegate);
 	}
+
+	// Progress goes from 0 to 1 and is measured in revealed characters
+	UFUNCTION(BlueprintCallable, Category = ExpressiveText)
+	static void BindOnRevealMilestone( UPARAM(ref) FExpressiveTextChronos& Chronos, float Progress, FOnTextRevealMilestoneDelegate Delegate )
+	{
+		Chronos.BindOnRevealMilestone(Progress, Delegate);
+	}
 	
 	
 
@@ -0,0 +1,279 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <Containers/StringView.h>
+
+#include <Fonts/FontCache.h>
+#include <Fonts/SlateFontInfo.h>
+#include <Framework/Application/SlateApplication.h>
+#include <Rendering/SlateRenderer.h>
+#include <Tickable.h>
+#include <UObject/ObjectKey.h>
+
+// Only what changes the shape of glyphs, the font material and the rest of FSlateFontInfo are applied when drawing
+struct FExTextShapingFontKey
+{
+    explicit FExTextShapingFontKey( const FSlateFontInfo& FontInfo )
+        : FontObject( FontInfo.FontObject )
+        , CompositeFont( FontInfo.CompositeFont )
+        , TypefaceFontName( FontInfo.TypefaceFontName )
+        , Size( FontInfo.Size )
+        , OutlineSize( FontInfo.OutlineSettings.OutlineSize )
+        , LetterSpacing( FontInfo.LetterSpacing )
+    {}
+
+    friend uint32 GetTypeHash( const FExTextShapingFontKey& Key )
+    {
+        uint32 Hash = GetTypeHash( Key.FontObject );
+        Hash = HashCombine( Hash, GetTypeHash( Key.CompositeFont.Get() ) );
+        Hash = HashCombine( Hash, GetTypeHash( Key.TypefaceFontName ) );
+        Hash = HashCombine( Hash, GetTypeHash( Key.Size ) );
+        Hash = HashCombine( Hash, GetTypeHash( Key.OutlineSize ) );
+        Hash = HashCombine( Hash, GetTypeHash( Key.LetterSpacing ) );
+        return Hash;
+    }
+
+    friend bool operator==( const FExTextShapingFontKey& Lhs, const FExTextShapingFontKey& Rhs )
+    {
+        return Lhs.FontObject == Rhs.FontObject &&
+            Lhs.CompositeFont == Rhs.CompositeFont &&
+            Lhs.TypefaceFontName == Rhs.TypefaceFontName &&
+            Lhs.Size == Rhs.Size &&
+            Lhs.OutlineSize == Rhs.OutlineSize &&
+            Lhs.LetterSpacing == Rhs.LetterSpacing;
+    }
+
+    FObjectKey FontObject;
+    TSharedPtr<const FCompositeFont> CompositeFont;
+    FName TypefaceFontName;
+    decltype( FSlateFontInfo::Size ) Size;
+    int32 OutlineSize;
+    int32 LetterSpacing;
+};
+
+// Built on every paint to find shaped glyphs, it only views the text so looking up doesn't allocate
+struct FExTextShapedGlyphsLookup
+{
+    FExTextShapedGlyphsLookup( FStringView InText, const FSlateFontInfo& InFontInfo, float InFontScale, ETextShapingMethod InShapingMethod, TextBiDi::ETextDirection InTextDirection )
+        : Text( InText )
+        , Font( InFontInfo )
+        , FontScale( InFontScale )
+        , ShapingMethod( InShapingMethod )
+        , TextDirection( InTextDirection )
+    {
+        Hash = FCrc::MemCrc32( Text.GetData(), Text.Len() * sizeof( TCHAR ) );
+        Hash = HashCombine( Hash, GetTypeHash( Font ) );
+        Hash = HashCombine( Hash, GetTypeHash( FontScale ) );
+        Hash = HashCombine( Hash, GetTypeHash( static_cast<uint8>( ShapingMethod ) ) );
+        Hash = HashCombine( Hash, GetTypeHash( static_cast<uint8>( TextDirection ) ) );
+    }
+
+    FStringView Text;
+    FExTextShapingFontKey Font;
+    float FontScale;
+    ETextShapingMethod ShapingMethod;
+    TextBiDi::ETextDirection TextDirection;
+    uint32 Hash;
+};
+
+// Owns its copy of the text, only made when a lookup misses
+struct FExTextShapedGlyphsKey
+{
+    explicit FExTextShapedGlyphsKey( const FExTextShapedGlyphsLookup& Lookup )
+        : Text( Lookup.Text )
+        , Font( Lookup.Font )
+        , FontScale( Lookup.FontScale )
+        , ShapingMethod( Lookup.ShapingMethod )
+        , TextDirection( Lookup.TextDirection )
+        , Hash( Lookup.Hash )
+    {}
+
+    friend uint32 GetTypeHash( const FExTextShapedGlyphsKey& Key )
+    {
+        return Key.Hash;
+    }
+
+    friend bool operator==( const FExTextShapedGlyphsKey& Lhs, const FExTextShapedGlyphsKey& Rhs )
+    {
+        return Lhs.Hash == Rhs.Hash &&
+            Lhs.FontScale == Rhs.FontScale &&
+            Lhs.ShapingMethod == Rhs.ShapingMethod &&
+            Lhs.TextDirection == Rhs.TextDirection &&
+            Lhs.Text.Equals( Rhs.Text, ESearchCase::CaseSensitive ) &&
+            Lhs.Font == Rhs.Font;
+    }
+
+    friend bool operator==( const FExTextShapedGlyphsKey& Lhs, const FExTextShapedGlyphsLookup& Rhs )
+    {
+        return Lhs.Hash == Rhs.Hash &&
+            Lhs.FontScale == Rhs.FontScale &&
+            Lhs.ShapingMethod == Rhs.ShapingMethod &&
+            Lhs.TextDirection == Rhs.TextDirection &&
+            FStringView( Lhs.Text ).Equals( Rhs.Text, ESearchCase::CaseSensitive ) &&
+            Lhs.Font == Rhs.Font;
+    }
+
+    FString Text;
+    FExTextShapingFontKey Font;
+    float FontScale;
+    ETextShapingMethod ShapingMethod;
+    TextBiDi::ETextDirection TextDirection;
+    uint32 Hash;
+};
+
+struct FExTextShapedGlyphs
+{
+    FShapedGlyphSequencePtr Sequence;
+    double LastUsedTimestamp;
+};
+
+// Shapes each unique piece of text once per font and reuses the result across runs, lines and draw passes.
+// Slate's shaped text cache works per line, so glyphs split into their own runs end up being re-extracted for every run.
+class FExTextGlyphShapingCache : public FTickableGameObject
+{
+public:
+
+    FExTextGlyphShapingCache()
+        : ShapedGlyphs()
+        , LastPurgeTimestamp( 0.0 )
+        , Hits( 0 )
+        , Misses( 0 )
+        , BoundFontCache()
+    {}
+
+    virtual ~FExTextGlyphShapingCache()
+    {
+        if( TSharedPtr<FSlateFontCache> FontCache = BoundFontCache.Pin() )
+        {
+            FontCache->OnReleaseResources().RemoveAll( this );
+        }
+    }
+
+    // Text can only be shaped out of its line when neighbouring glyphs can't change its shape, which
+    // is the case for kerning only shaping (what Auto picks for left to right text)
+    static bool CanShapeInIsolation( ETextShapingMethod ShapingMethod, TextBiDi::ETextDirection TextDirection )
+    {
+        return ShapingMethod == ETextShapingMethod::KerningOnly ||
+            ( ShapingMethod == ETextShapingMethod::Auto && TextDirection == TextBiDi::ETextDirection::LeftToRight );
+    }
+
+    // Atlas scales follow animated scales, rounding them up to a fixed step keeps those from shaping a new entry every frame.
+    // Callers draw glyphs shaped at this scale and compensate for the difference with their render transform
+    static float QuantizeFontScale( float FontScale )
+    {
+        static constexpr float FontScaleSteps = 16.f;
+        return FMath::Max( FMath::CeilToFloat( FontScale * FontScaleSteps ), 1.f ) / FontScaleSteps;
+    }
+
+    // Expects an already quantized font scale
+    FShapedGlyphSequenceRef GetShapedGlyphs( FStringView Text, const FSlateFontInfo& FontInfo, float FontScale, ETextShapingMethod ShapingMethod, TextBiDi::ETextDirection TextDirection )
+    {
+        TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+        BindToFontCache( FontCache );
+
+        const FExTextShapedGlyphsLookup Lookup( Text, FontInfo, FontScale, ShapingMethod, TextDirection );
+
+        if( FExTextShapedGlyphs* Found = ShapedGlyphs.FindByHash( Lookup.Hash, Lookup ) )
+        {
+            Hits++;
+            Found->LastUsedTimestamp = FPlatformTime::Seconds();
+            return Found->Sequence.ToSharedRef();
+        }
+
+        Misses++;
+
+        FShapedGlyphSequenceRef Sequence = FontCache->ShapeUnidirectionalText( Text.GetData(), 0, Text.Len(), FontInfo, FontScale, TextDirection, ShapingMethod );
+
+        FExTextShapedGlyphs& Entry = ShapedGlyphs.Add( FExTextShapedGlyphsKey( Lookup ) );
+        Entry.Sequence = Sequence;
+        Entry.LastUsedTimestamp = FPlatformTime::Seconds();
+        return Sequence;
+    }
+
+    int32 GetHits() const
+    {
+        return Hits;
+    }
+
+    int32 GetMisses() const
+    {
+        return Misses;
+    }
+
+    int32 Num() const
+    {
+        return ShapedGlyphs.Num();
+    }
+
+    void Empty()
+    {
+        ShapedGlyphs.Empty();
+    }
+
+    void TryPurgeCache()
+    {
+        static constexpr double ShapingCachePurgeInterval = 5.0;
+        static constexpr double ShapedGlyphsTimeToLive = 10.0;
+
+        const double CurrentTime = FPlatformTime::Seconds();
+        if( CurrentTime - LastPurgeTimestamp < ShapingCachePurgeInterval )
+        {
+            return;
+        }
+
+        LastPurgeTimestamp = CurrentTime;
+
+        for( auto It = ShapedGlyphs.CreateIterator(); It; ++It )
+        {
+            if( CurrentTime - It.Value().LastUsedTimestamp > ShapedGlyphsTimeToLive )
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    virtual bool IsTickableWhenPaused() const override
+    {
+        return true;
+    }
+
+    virtual bool IsTickableInEditor() const override
+    {
+        return true;
+    }
+
+    virtual TStatId GetStatId() const override
+    {
+        RETURN_QUICK_DECLARE_CYCLE_STAT(FExTextGlyphShapingCache, STATGROUP_Tickables);
+    }
+
+    virtual void Tick(float DeltaTime) override
+    {
+        TryPurgeCache();
+    }
+
+private:
+
+    void BindToFontCache( const TSharedRef<FSlateFontCache>& FontCache )
+    {
+        if( !BoundFontCache.HasSameObject( &FontCache.Get() ) )
+        {
+            // Shaped glyphs point into font atlases so they have to go when slate flushes its fonts
+            FontCache->OnReleaseResources().AddRaw( this, &FExTextGlyphShapingCache::OnFontResourcesReleased );
+            BoundFontCache = FontCache;
+        }
+    }
+
+    void OnFontResourcesReleased( const FSlateFontCache& FontCache )
+    {
+        Empty();
+    }
+
+    TMap<FExTextShapedGlyphsKey, FExTextShapedGlyphs> ShapedGlyphs;
+    double LastPurgeTimestamp;
+    int32 Hits;
+    int32 Misses;
+    TWeakPtr<FSlateFontCache> BoundFontCache;
+};
@@ -13,6 +13,7 @@ struct FExTextMIDRequest
         : BaseMaterial( InMat )
         , ScalarParams()
         , VectorParams()
+        , TextureParams()
     {}
 
     void AddScalar( const FMaterialParameterInfo& Param, float Value )
@@ -25,9 +26,15 @@ struct FExTextMIDRequest
         VectorParams.Add( Param, Value );
     }
 
+    void AddTexture( const FMaterialParameterInfo& Param, UTexture* Value )
+    {
+        TextureParams.Add( Param, Value );
+    }
+
     UMaterialInterface& BaseMaterial;
     TMap<FMaterialParameterInfo, float> ScalarParams;
     TMap<FMaterialParameterInfo, FLinearColor> VectorParams;
+    TMap<FMaterialParameterInfo, UTexture*> TextureParams;
 };
 
 
@@ -49,6 +56,12 @@ struct FExTextMIDChecksum
             Checksum =  HashCombine( Checksum, GetTypeHash( VectorParam.Key ) );
             Checksum =  HashCombine( Checksum, GetTypeHash( VectorParam.Value ) );
         }
+
+        for ( const auto& TextureParam : Request.TextureParams )
+        {
+            Checksum =  HashCombine( Checksum, GetTypeHash( TextureParam.Key ) );
+            Checksum =  HashCombine( Checksum, GetTypeHash( TextureParam.Value ) );
+        }
     }
 
     friend uint32 GetTypeHash( const FExTextMIDChecksum& MID )
@@ -123,9 +136,19 @@ public:
             NewMID->MID->SetVectorParameterValueByInfo(VectorParam.Key, VectorParam.Value);
         }
 
+        for (const auto& TextureParam : Request.TextureParams)
+        {
+            NewMID->MID->SetTextureParameterValueByInfo(TextureParam.Key, TextureParam.Value);
+        }
+
         return MIDCache.Add( Checksum, NewMID );
     }
 
+    int32 Num() const
+    {
+        return MIDCache.Num();
+    }
+
     void TryPurgeCache()
     {
         static constexpr float MIDCachePurgeInterval = 5.0f;
@@ -5,10 +5,14 @@
 
 #include "Layout/ExpressiveTextRun.h"
 #include "Layout/ExTextSharedLayoutData.h"
+#include "Parameters/ExpressiveTextParameterLookup.h"
 
+#include <Algo/BinarySearch.h>
+#include <Algo/Sort.h>
 #include <Framework/Text/ISlateLineHighlighter.h>
 #include <Framework/Text/ISlateRunRenderer.h>
 #include <Framework/Text/TextLayout.h>
+#include <Internationalization/BreakIterator.h>
 #include <Layout/Children.h>
 #include <Styling/SlateTypes.h>
 
@@ -32,6 +36,40 @@
 //    }
 //};
 
+// Result of a glyph hit test, all indices are relative to the text of the line
+struct FExTextGlyphHit
+{
+	int32 LineIndex = INDEX_NONE;
+	int32 CharacterIndex = INDEX_NONE;
+	FTextRange WordRange;
+	FTextRange SourceRange;
+	FName StyleName;
+};
+
+// A line of a virtualized text, keeps what is needed to create its runs again once it scrolls back into view
+struct FExTextVirtualLine
+{
+	FExTextVirtualLine(const TSharedRef<FString>& InText, const TSharedRef<FExpressiveTextExtraction>& InExtraction, float InRevealStartTime)
+		: Text( InText )
+		, Extraction( InExtraction )
+		, RevealStartTime( InRevealStartTime )
+		, RunClearStartTimes()
+		, MeasuredHeight()
+		, Runs()
+	{}
+
+	TSharedRef<FString> Text;
+	TSharedRef<FExpressiveTextExtraction> Extraction;
+	float RevealStartTime;
+	TArray<float> RunClearStartTimes;
+	TOptional<float> MeasuredHeight;
+
+	// Only set while the line is materialized
+	TArray<TSharedRef<FExpressiveTextRun>> Runs;
+};
+
+using FExTextVirtualLineMaterializer = TFunction<void(const FExTextVirtualLine& Line, TArray<TSharedRef<FExpressiveTextRun>>& OutRuns)>;
+
 class FExpressiveTextSlateLayout : public FTextLayout
 {
 	struct FSlotAndParentWrapper
@@ -50,6 +88,17 @@ public:
 		: FTextLayout()
 		, SharedData( MakeShareable(new FExTextSharedLayoutData))
 		, TextTotalLength( 0 )
+		, LinesGeneration( 0 )
+		, IsVirtualizedLayout( false )
+		, VirtualLines()
+		, VirtualLineMaterializer()
+		, VirtualLineTops()
+		, VirtualLineTopsDirty( true )
+		, VirtualWindowBegin( 0 )
+		, VirtualWindowEnd( 0 )
+		, VirtualMeasuredHeightSum( 0.f )
+		, VirtualMeasuredLineCount( 0 )
+		, VirtualMaxLineWidth( 0.f )
 	{
 	}
 
@@ -104,7 +153,147 @@ public:
 
 	int GetTextTotalLength() const
 	{
-		return TextTotalLength;
+		// Only the window has runs, every glyph of the document has a reveal time though
+		return IsVirtualizedLayout ? SharedData->Chronos.GetNumGlyphs() : TextTotalLength;
+	}
+
+	// Use instead of ClearLines so appends compiled against the previous lines can tell they are stale
+	void ResetLines()
+	{
+		ClearLines();
+		LinesGeneration++;
+
+		IsVirtualizedLayout = false;
+		VirtualLines.Empty();
+		VirtualLineMaterializer = nullptr;
+		VirtualLineTops.Empty();
+		VirtualLineTopsDirty = true;
+		VirtualWindowBegin = 0;
+		VirtualWindowEnd = 0;
+		VirtualMeasuredHeightSum = 0.f;
+		VirtualMeasuredLineCount = 0;
+		VirtualMaxLineWidth = 0.f;
+	}
+
+	bool IsVirtualized() const
+	{
+		return IsVirtualizedLayout;
+	}
+
+	// Takes every line of the document but only keeps runs for the lines at the top, UpdateVirtualWindow moves the window afterwards.
+	// Lines may come with their runs already created, the ones outside of the window are released.
+	void SetVirtualLines(TArray<FExTextVirtualLine> InVirtualLines, FExTextVirtualLineMaterializer InMaterializer)
+	{
+		IsVirtualizedLayout = true;
+		VirtualLines = MoveTemp(InVirtualLines);
+		VirtualLineMaterializer = MoveTemp(InMaterializer);
+		VirtualLineTopsDirty = true;
+
+		// Treat every line as materialized so the runs that came along are released
+		VirtualWindowBegin = 0;
+		VirtualWindowEnd = VirtualLines.Num();
+		SetVirtualWindow(0, GetVirtualLineIndexAt(MinVirtualWindowMargin) + 1);
+	}
+
+	// Visible range in unscaled layout space, relative to the top of the document.
+	// The window only moves once the visible range leaves it, and then covers it with a margin on both sides.
+	void UpdateVirtualWindow(float VisibleTop, float VisibleBottom)
+	{
+		if (!IsVirtualizedLayout || VirtualLines.Num() == 0)
+		{
+			return;
+		}
+
+		const int32 FirstVisibleLine = GetVirtualLineIndexAt(VisibleTop);
+		const int32 LastVisibleLine = GetVirtualLineIndexAt(VisibleBottom);
+		if (FirstVisibleLine >= VirtualWindowBegin && LastVisibleLine < VirtualWindowEnd)
+		{
+			return;
+		}
+
+		const float Margin = FMath::Max(VisibleBottom - VisibleTop, MinVirtualWindowMargin);
+		SetVirtualWindow(GetVirtualLineIndexAt(VisibleTop - Margin), GetVirtualLineIndexAt(VisibleBottom + Margin) + 1);
+	}
+
+	// Heights depend on the wrapping width so they have to be measured again
+	void InvalidateVirtualLineHeights()
+	{
+		for (FExTextVirtualLine& Line : VirtualLines)
+		{
+			Line.MeasuredHeight.Reset();
+		}
+
+		VirtualMeasuredHeightSum = 0.f;
+		VirtualMeasuredLineCount = 0;
+		VirtualMaxLineWidth = 0.f;
+		VirtualLineTopsDirty = true;
+	}
+
+	int32 GetVirtualWindowBegin() const
+	{
+		return IsVirtualizedLayout ? VirtualWindowBegin : 0;
+	}
+
+	// Distance from the top of the document to the first materialized line
+	float GetVirtualTopOffset() const
+	{
+		if (!IsVirtualizedLayout || VirtualLines.Num() == 0)
+		{
+			return 0.f;
+		}
+
+		RebuildVirtualLineTopsIfNeeded();
+		return VirtualLineTops[VirtualWindowBegin];
+	}
+
+	// Size of the whole document, lines that were never laid out use the average height of the measured ones
+	FVector2D GetVirtualSize() const
+	{
+		if (!IsVirtualizedLayout || VirtualLines.Num() == 0)
+		{
+			return GetSize();
+		}
+
+		RebuildVirtualLineTopsIfNeeded();
+		return FVector2D(FMath::Max(VirtualMaxLineWidth, GetSize().X), VirtualLineTops.Last());
+	}
+
+	uint32 GetLinesGeneration() const
+	{
+		return LinesGeneration;
+	}
+
+	// Evicts lines from the front until at most MaxLines remain, MaxLines <= 0 keeps every line
+	int32 TrimFrontLines(int32 MaxLines, TArray<float>& OutRemovedGlyphRevealTimes)
+	{
+		int32 NumRemoved = 0;
+		while (MaxLines > 0 && LineModels.Num() > MaxLines)
+		{
+			for (const FRunModel& RunModel : LineModels[0].Runs)
+			{
+				StaticCastSharedRef<FExpressiveTextRun>(RunModel.GetRun())->AppendGlyphRevealTimes(OutRemovedGlyphRevealTimes);
+			}
+
+			RemoveLine(0);
+			NumRemoved++;
+		}
+
+		return NumRemoved;
+	}
+
+	// Swaps the text and runs of a line, the other lines keep their shaping and wrapping until the next layout update
+	void ReplaceLine(int32 LineIndex, const TSharedRef<FString>& Text, const TArray<TSharedRef<IRun>>& Runs)
+	{
+		check(LineModels.IsValidIndex(LineIndex));
+
+		FLineModel LineModel(Text);
+		for (const TSharedRef<IRun>& Run : Runs)
+		{
+			LineModel.Runs.Add(FRunModel(Run));
+		}
+
+		LineModels[LineIndex] = MoveTemp(LineModel);
+		DirtyLayout();
 	}
 
 	FChildren* GetChildren()
@@ -147,7 +336,7 @@ public:
 			// Is this line visible?  This checks if the culling rect, which represents the AABB around the last clipping rect, intersects the 
 			// line of text, this requires that we get the text line into render space.
 			// TODO perhaps save off this line view rect during text layout?
-			const FVector2D LocalLineOffset = LineView.Offset * InverseScale;
+			const FVector2D LocalLineOffset = LineView.Offset * InverseScale + SharedData->AlignmentOffset;
 			const FSlateRect LineViewRect(AllottedGeometry.GetRenderBoundingRect(FSlateRect(LocalLineOffset, LocalLineOffset + (LineView.Size * InverseScale))));
 			if (!FSlateRect::DoRectanglesIntersect(LineViewRect, MyCullingRect))
 			{
@@ -230,6 +419,13 @@ public:
 	virtual void EndLayout() override
 	{
 		FTextLayout::EndLayout();
+		bGlyphHitTableDirty = true;
+
+		if (IsVirtualizedLayout)
+		{
+			RecordVirtualLineHeights();
+		}
+
 		if (SlotAndParent && SlotAndParent->ParentWidget.IsValid())
 		{
 			AggregateChildren();
@@ -296,23 +492,45 @@ public:
 	}
 
 
-	int GetTotalGlyphsRevealed()
+	int GetTotalGlyphsRevealed() const
 	{
-		float result = 0;
-		const TArray< FLineModel >& LayoutLineModels = GetLineModels();
-		for (int32 LineModelIndex = 0; LineModelIndex < LayoutLineModels.Num(); LineModelIndex++)
+		// Reveal times are gathered from the runs at compile time, see FExpressiveTextRun::AppendGlyphRevealTimes
+		return SharedData->Chronos.GetNumRevealedGlyphs();
+	}
+
+	// LayoutPosition is in the scaled layout space, same as GetTextLocationAt
+	bool FindGlyphAt(const FVector2D& LayoutPosition, FExTextGlyphHit& OutHit) const
+	{
+		if (bGlyphHitTableDirty)
 		{
-			const FLineModel& LineModel = LayoutLineModels[LineModelIndex];
-			for (int32 RunIndex = 0; RunIndex < LineModel.Runs.Num(); RunIndex++)
-			{
-				const FRunModel& LineRun = LineModel.Runs[RunIndex];
-				const TSharedRef< FExpressiveTextRun > SlateRun = StaticCastSharedRef< FExpressiveTextRun >(LineRun.GetRun());
+			BuildGlyphHitTable();
+		}
 
-				result += SlateRun->GetNumGlyphsRevealedInThisRun();
-			}
+		// Line views are laid out top to bottom
+		const int32 LineIndex = Algo::UpperBoundBy(GlyphHitTable.Lines, LayoutPosition.Y, &FGlyphHitLine::Top) - 1;
+		if (!GlyphHitTable.Lines.IsValidIndex(LineIndex) || LayoutPosition.Y >= GlyphHitTable.Lines[LineIndex].Bottom)
+		{
+			return false;
 		}
 
-		return result;
+		const FGlyphHitLine& Line = GlyphHitTable.Lines[LineIndex];
+		const TArrayView<const FGlyphHitRect> LineGlyphs(GlyphHitTable.Glyphs.GetData() + Line.FirstGlyph, Line.NumGlyphs);
+
+		const int32 GlyphIndex = Algo::UpperBoundBy(LineGlyphs, LayoutPosition.X, &FGlyphHitRect::Right);
+		if (!LineGlyphs.IsValidIndex(GlyphIndex) || LayoutPosition.X < LineGlyphs[GlyphIndex].Left)
+		{
+			return false;
+		}
+
+		const FGlyphHitRect& Glyph = LineGlyphs[GlyphIndex];
+		const FGlyphHitRun& Run = GlyphHitTable.Runs[Glyph.RunIndex];
+
+		OutHit.LineIndex = Line.ModelIndex + GetVirtualWindowBegin();
+		OutHit.CharacterIndex = Glyph.CharacterIndex;
+		OutHit.WordRange = GlyphHitTable.Words.IsValidIndex(Glyph.WordIndex) ? GlyphHitTable.Words[Glyph.WordIndex] : FTextRange(Glyph.CharacterIndex, Glyph.CharacterIndex);
+		OutHit.SourceRange = Run.SourceRange;
+		OutHit.StyleName = Run.StyleName;
+		return true;
 	}
 
 	void ResetAutoSizeCache()
@@ -392,6 +610,278 @@ public:
 		UpdateLayout();
 	}
 
+private:
+
+	struct FGlyphHitLine
+	{
+		float Top;
+		float Bottom;
+		int32 ModelIndex;
+		int32 FirstGlyph;
+		int32 NumGlyphs;
+	};
+
+	struct FGlyphHitRect
+	{
+		float Left;
+		float Right;
+		int32 CharacterIndex;
+		int32 WordIndex;
+		int32 RunIndex;
+	};
+
+	struct FGlyphHitRun
+	{
+		FTextRange SourceRange;
+		FName StyleName;
+	};
+
+	struct FGlyphHitTable
+	{
+		TArray<FGlyphHitLine> Lines;
+		TArray<FGlyphHitRect> Glyphs;
+		TArray<FTextRange> Words;
+		TArray<FGlyphHitRun> Runs;
+
+		void Reset()
+		{
+			Lines.Reset();
+			Glyphs.Reset();
+			Words.Reset();
+			Runs.Reset();
+		}
+	};
+
+	// Measures every glyph of the line views once so hit tests don't have to go through GetTextLocationAt
+	void BuildGlyphHitTable() const
+	{
+		bGlyphHitTableDirty = false;
+		GlyphHitTable.Reset();
+
+		const TArray<FLineModel>& LayoutLineModels = GetLineModels();
+		TSharedRef<IBreakIterator> WordBreakIterator = FBreakIterator::CreateWordBreakIterator();
+
+		// Word index of each character of the current line model, wrapped line views share their model
+		TArray<int32> CharacterWords;
+		int32 CurrentModelIndex = INDEX_NONE;
+
+		TMap<const IRun*, int32> RunIndices;
+
+		for (const FTextLayout::FLineView& LineView : LineViews)
+		{
+			if (!LayoutLineModels.IsValidIndex(LineView.ModelIndex))
+			{
+				continue;
+			}
+
+			if (LineView.ModelIndex != CurrentModelIndex)
+			{
+				CurrentModelIndex = LineView.ModelIndex;
+				const FString& LineText = LayoutLineModels[CurrentModelIndex].Text.Get();
+
+				CharacterWords.Init(INDEX_NONE, LineText.Len());
+
+				WordBreakIterator->SetStringRef(&LineText);
+				for (int32 PreviousBreak = WordBreakIterator->ResetToBeginning(), NextBreak = WordBreakIterator->MoveToNext(); NextBreak != INDEX_NONE; PreviousBreak = NextBreak, NextBreak = WordBreakIterator->MoveToNext())
+				{
+					bool IsWord = false;
+					for (int32 CharIndex = PreviousBreak; CharIndex < NextBreak && !IsWord; CharIndex++)
+					{
+						IsWord = FChar::IsAlnum(LineText[CharIndex]);
+					}
+
+					if (IsWord)
+					{
+						const int32 WordIndex = GlyphHitTable.Words.Emplace(PreviousBreak, NextBreak);
+						for (int32 CharIndex = PreviousBreak; CharIndex < NextBreak; CharIndex++)
+						{
+							CharacterWords[CharIndex] = WordIndex;
+						}
+					}
+				}
+				WordBreakIterator->ClearString();
+			}
+
+			FGlyphHitLine& Line = GlyphHitTable.Lines.AddDefaulted_GetRef();
+			Line.Top = LineView.Offset.Y;
+			Line.Bottom = LineView.Offset.Y + LineView.Size.Y;
+			Line.ModelIndex = LineView.ModelIndex;
+			Line.FirstGlyph = GlyphHitTable.Glyphs.Num();
+
+			for (const TSharedRef<ILayoutBlock>& Block : LineView.Blocks)
+			{
+				const TSharedRef<IRun> Run = Block->GetRun();
+				const FTextRange BlockRange = Block->GetTextRange();
+				const FLayoutBlockTextContext BlockTextContext = Block->GetTextContext();
+				const float BlockLeft = Block->GetLocationOffset().X;
+
+				int32 RunIndex = INDEX_NONE;
+				if (const int32* FoundRunIndex = RunIndices.Find(&Run.Get()))
+				{
+					RunIndex = *FoundRunIndex;
+				}
+				else
+				{
+					const TSharedRef<FExpressiveTextRun> ExpressiveRun = StaticCastSharedRef<FExpressiveTextRun>(Run);
+					const TSharedPtr<FExpressiveTextParameterLookup> Lookup = ExpressiveRun->GetLookup();
+
+					RunIndex = GlyphHitTable.Runs.Add({ ExpressiveRun->GetSourceRange(), Lookup ? Lookup->GetDescriptor() : NAME_None });
+					RunIndices.Add(&Run.Get(), RunIndex);
+				}
+
+				float GlyphLeft = BlockLeft;
+				for (int32 CharIndex = BlockRange.BeginIndex; CharIndex < BlockRange.EndIndex; CharIndex++)
+				{
+					const float GlyphRight = BlockLeft + Run->Measure(BlockRange.BeginIndex, CharIndex + 1, Scale, BlockTextContext).X;
+					GlyphHitTable.Glyphs.Add({ GlyphLeft, GlyphRight, CharIndex, CharacterWords.IsValidIndex(CharIndex) ? CharacterWords[CharIndex] : INDEX_NONE, RunIndex });
+					GlyphLeft = GlyphRight;
+				}
+			}
+
+			Line.NumGlyphs = GlyphHitTable.Glyphs.Num() - Line.FirstGlyph;
+
+			// Blocks are stored in visual order already but keep the binary search safe for mixed direction lines
+			Algo::SortBy(MakeArrayView(GlyphHitTable.Glyphs.GetData() + Line.FirstGlyph, Line.NumGlyphs), &FGlyphHitRect::Left);
+		}
+	}
+
+	mutable FGlyphHitTable GlyphHitTable;
+	mutable bool bGlyphHitTableDirty = true;
+
+	// Lines materialized around the visible range even when little is visible
+	static constexpr float MinVirtualWindowMargin = 512.f;
+
+	// Used for lines that were never laid out until a line has been measured
+	static constexpr float DefaultVirtualLineHeight = 24.f;
+
+	float GetEstimatedVirtualLineHeight() const
+	{
+		return VirtualMeasuredLineCount > 0 ? VirtualMeasuredHeightSum / VirtualMeasuredLineCount : DefaultVirtualLineHeight;
+	}
+
+	void RebuildVirtualLineTopsIfNeeded() const
+	{
+		if (!VirtualLineTopsDirty)
+		{
+			return;
+		}
+
+		VirtualLineTopsDirty = false;
+
+		const float EstimatedHeight = GetEstimatedVirtualLineHeight();
+
+		VirtualLineTops.SetNumUninitialized(VirtualLines.Num() + 1);
+		VirtualLineTops[0] = 0.f;
+		for (int32 LineIndex = 0; LineIndex < VirtualLines.Num(); LineIndex++)
+		{
+			const TOptional<float>& MeasuredHeight = VirtualLines[LineIndex].MeasuredHeight;
+			VirtualLineTops[LineIndex + 1] = VirtualLineTops[LineIndex] + (MeasuredHeight.IsSet() ? MeasuredHeight.GetValue() : EstimatedHeight);
+		}
+	}
+
+	int32 GetVirtualLineIndexAt(float Y) const
+	{
+		RebuildVirtualLineTopsIfNeeded();
+		const int32 LineIndex = Algo::UpperBound(VirtualLineTops, Y) - 1;
+		return FMath::Clamp(LineIndex, 0, VirtualLines.Num() - 1);
+	}
+
+	void SetVirtualWindow(int32 Begin, int32 End)
+	{
+		Begin = FMath::Clamp(Begin, 0, VirtualLines.Num());
+		End = FMath::Clamp(End, Begin, VirtualLines.Num());
+
+		// Releasing the runs also releases their material instances back to the MID cache
+		for (int32 LineIndex = VirtualWindowBegin; LineIndex < VirtualWindowEnd; LineIndex++)
+		{
+			if (LineIndex < Begin || LineIndex >= End)
+			{
+				VirtualLines[LineIndex].Runs.Empty();
+			}
+		}
+
+		VirtualWindowBegin = Begin;
+		VirtualWindowEnd = End;
+
+		ClearLines();
+
+		TArray<FTextLayout::FNewLineData> LineDatas;
+		LineDatas.Reserve(End - Begin);
+
+		for (int32 LineIndex = Begin; LineIndex < End; LineIndex++)
+		{
+			FExTextVirtualLine& Line = VirtualLines[LineIndex];
+			if (Line.Runs.Num() == 0 && VirtualLineMaterializer)
+			{
+				VirtualLineMaterializer(Line, Line.Runs);
+
+				if (Line.RunClearStartTimes.Num() == Line.Runs.Num())
+				{
+					for (int32 RunIndex = 0; RunIndex < Line.Runs.Num(); RunIndex++)
+					{
+						Line.Runs[RunIndex]->SetClearStartTime(Line.RunClearStartTimes[RunIndex]);
+					}
+				}
+			}
+
+			TArray<TSharedRef<IRun>> CastRuns;
+			CastRuns.Reserve(Line.Runs.Num());
+			for (const TSharedRef<FExpressiveTextRun>& Run : Line.Runs)
+			{
+				CastRuns.Add(Run);
+			}
+
+			LineDatas.Add(FTextLayout::FNewLineData(Line.Text, CastRuns));
+		}
+
+		AddLines(LineDatas);
+	}
+
+	void RecordVirtualLineHeights()
+	{
+		const float InverseScale = Inverse(Scale);
+
+		TArray<float, TInlineAllocator<64>> WindowHeights;
+		WindowHeights.SetNumZeroed(LineModels.Num());
+
+		// Wrapped lines have several views for the same model
+		for (const FTextLayout::FLineView& LineView : LineViews)
+		{
+			if (WindowHeights.IsValidIndex(LineView.ModelIndex))
+			{
+				WindowHeights[LineView.ModelIndex] += LineView.Size.Y * InverseScale;
+				VirtualMaxLineWidth = FMath::Max(VirtualMaxLineWidth, LineView.Size.X * InverseScale);
+			}
+		}
+
+		for (int32 ModelIndex = 0; ModelIndex < WindowHeights.Num(); ModelIndex++)
+		{
+			if (!VirtualLines.IsValidIndex(VirtualWindowBegin + ModelIndex))
+			{
+				continue;
+			}
+
+			TOptional<float>& MeasuredHeight = VirtualLines[VirtualWindowBegin + ModelIndex].MeasuredHeight;
+			if (MeasuredHeight.IsSet() && MeasuredHeight.GetValue() == WindowHeights[ModelIndex])
+			{
+				continue;
+			}
+
+			if (MeasuredHeight.IsSet())
+			{
+				VirtualMeasuredHeightSum -= MeasuredHeight.GetValue();
+			}
+			else
+			{
+				VirtualMeasuredLineCount++;
+			}
+
+			MeasuredHeight = WindowHeights[ModelIndex];
+			VirtualMeasuredHeightSum += WindowHeights[ModelIndex];
+			VirtualLineTopsDirty = true;
+		}
+	}
+
 protected:
 
 	virtual int32 OnPaintHighlights(const FPaintArgs& Args, const FTextLayout::FLineView& LineView, const TArray<FLineViewHighlight>& Highlights, const FTextBlockStyle& InDefaultTextStyle, const FGeometry& AllottedGeometry, const FSlateRect& ClippingRect, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
@@ -423,4 +913,16 @@ private:
 	FVector2D LastProcessedAreaForAutoSize = FVector2D:: ZeroVector;
 	float LastProcessedScaleForAutoSize = -1.f;
 	int TextTotalLength;
+	uint32 LinesGeneration;
+
+	bool IsVirtualizedLayout;
+	TArray<FExTextVirtualLine> VirtualLines;
+	FExTextVirtualLineMaterializer VirtualLineMaterializer;
+	mutable TArray<float> VirtualLineTops;
+	mutable bool VirtualLineTopsDirty;
+	int32 VirtualWindowBegin;
+	int32 VirtualWindowEnd;
+	float VirtualMeasuredHeightSum;
+	int32 VirtualMeasuredLineCount;
+	float VirtualMaxLineWidth;
 };
\ No newline at end of file
@@ -40,13 +40,22 @@ public:
 
 	void SetParameterLookup(TSharedPtr<FExpressiveTextParameterLookup> InLookup) { Lookup = InLookup; }
 	void SetClearStartTime(float InTime) { ClearStartTime = InTime; }
+	float GetClearStartTime() const { return ClearStartTime; }
+	float GetRevealStartTime() const { return RevealStartTime; }
+	// Moves the reveal of lines that follow one whose length changed after it was compiled
+	void OffsetRevealStartTime(float Offset) { RevealStartTime += Offset; }
 	TSharedPtr<FExpressiveTextParameterLookup> GetLookup() const { return Lookup; }
 
 	void SetOwnerExtraction(TSharedPtr<FExpressiveTextExtraction> InOwnerExtraction ){ OwnerExtraction = InOwnerExtraction; }
 	TSharedPtr<FExpressiveTextExtraction> GetOwnerExtraction() const { return OwnerExtraction; }
 
+	// Range of the tag section this run was created from, runs split per glyph all share it
+	void SetSourceRange(const FTextRange& InSourceRange) { SourceRange = InSourceRange; }
+	const FTextRange& GetSourceRange() const { return SourceRange; }
+
 	float CalculateDurationToFullyReveal() const;
 	float CalculateDurationToFullyClear() const;
+	void AppendGlyphRevealTimes(TArray<float>& OutRevealTimes) const;
 
 	int GetNumGlyphsRevealedInThisRun()
 	{
@@ -60,6 +69,10 @@ public:
 		World = InWorld;
 	}
 
+	// Glyph animations can be left to the font material when nothing on the CPU side needs to observe each glyph being revealed
+	bool ShouldEvaluateAnimationOnGPU() const;
+	static bool CanEvaluateAnimationOnGPU(const FExpressiveTextParameterLookup& InLookup, bool HasInterjections);
+
 	void FireInterjections(int32 SpecificIndex = -1) const;
 	void ProcessInterjectionModifiers(struct FInterjectionOutput& Out, int32 SpecificIndex = -1) const;
 	void FillMaterialRequest(const class UExpressiveTextMaterial& Material, int32 LayerIndex, struct FExTextMIDRequest& Request, const FGeometry& BlockGeom, int32 LineIndex, float FontSizeCompensation, FVector4 RevealAndClearInformation) const;
@@ -107,6 +120,7 @@ public:
 private:
 	TSharedPtr<FExpressiveTextParameterLookup> Lookup;
 	TSharedPtr<FExpressiveTextExtraction> OwnerExtraction;
+	FTextRange SourceRange;
 	TSharedPtr<FExTextSharedLayoutData> SharedData;
 	TWeakObjectPtr<UWorld> World;
 	float RevealStartTime;
@@ -115,6 +129,7 @@ private:
 	float AutoFontSize;
 	mutable TSharedPtr<FExTextMID> CachedMID;
 	mutable TSharedPtr<FExTextMID> CachedOutlineMID;
+	mutable float CachedMIDStartTime;
 	mutable TArray< FInterjectionTracker > Interjections;
 	mutable int32 LastRevealCharacterIndex;
 	mutable int NumGlyphsRevealedInThisRun;
@@ -124,12 +139,14 @@ public:
 protected:
 	FExpressiveTextRun(const FRunInfo& InRunInfo, const TSharedRef< const FString >& InText, const FTextBlockStyle& InStyle, const FTextRange& InRange, TSharedRef<FExTextSharedLayoutData> InSharedData, float InRevealStartTime )
 		: FSlateTextRun(InRunInfo, InText, InStyle, InRange)
+		, SourceRange( InRange )
 		, SharedData( InSharedData )
 		, World()
 		, RevealStartTime( InRevealStartTime )
 		, ClearStartTime( -1.f )
 		, FontSize( InStyle.Font.Size )
 		, AutoFontSize( 1.f )
+		, CachedMIDStartTime( -1.f )
 		, Interjections()
 		, LastRevealCharacterIndex( -1000 )
 		, NumGlyphsRevealedInThisRun( 0 )
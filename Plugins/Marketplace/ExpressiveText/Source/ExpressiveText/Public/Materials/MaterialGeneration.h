@@ -11,7 +11,11 @@ class UExpressiveTextMaterial;
 class EXPRESSIVETEXT_API MaterialGeneration
 {
 public:
-    static void ReconstructCombinedMaterial(UObject* Outer, UMaterialInstanceConstant*& ExistingMaterial, const TArray<UExpressiveTextMaterial*>& ExTextMats, bool MarkAsDirty = true);
+    // Regenerates the combined material when the layer stack hash differs from InOutLayerStackHash.
+    // Stacks generated before are reused from a shared cache instead of compiling a new permutation.
+    static void ReconstructCombinedMaterial(UObject* Outer, UMaterialInstanceConstant*& ExistingMaterial, const TArray<UExpressiveTextMaterial*>& ExTextMats, bool MarkAsDirty = true, uint32* InOutLayerStackHash = nullptr);
+    // Hash of everything the static permutation depends on: base material, blend, layers and their order
+    static uint32 HashLayerStack(const TArray<UExpressiveTextMaterial*>& ExTextMats);
     static FMaterialLayersFunctions GetLayers(const UMaterialInstance* Material, const FStaticParameterSet& StaticParameters);
     static void SetLayers(UMaterialInstance* Material, FStaticParameterSet& StaticParameters, const FMaterialLayersFunctions& Layers);
 };
\ No newline at end of file
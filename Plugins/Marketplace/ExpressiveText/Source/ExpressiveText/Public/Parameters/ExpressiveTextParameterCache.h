@@ -31,6 +31,15 @@ public:
 		LookupTable.Emplace( Value.GetClass(), &Value );
 	}
 
+	// Overrides entries with the ones from Other
+	void Append( const FExpressiveTextParameterCache& Other )
+	{
+		for (const auto& Entry : Other.LookupTable)
+		{
+			LookupTable.Emplace( Entry.Key, Entry.Value.Get() );
+		}
+	}
+
 private:
 	TMap< TSubclassOf<UExpressiveTextParameterValue>, TStrongObjectPtr<UExpressiveTextParameterValue> > LookupTable;
 };
\ No newline at end of file
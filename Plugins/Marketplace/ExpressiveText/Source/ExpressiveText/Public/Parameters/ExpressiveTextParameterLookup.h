@@ -27,6 +27,8 @@ struct FExpressiveTextParameterLookup
 
 	void SetNext( const TSharedPtr<FExpressiveTextParameterLookup>& InNext );
 
+	const FName& GetDescriptor() const { return Descriptor; }
+
     template< typename ValueObjectType, typename ValueType = typename ValueObjectType::ValueType >
     const ValueType& GetValue() const
     {
@@ -195,6 +195,16 @@ struct FExText_GlyphAnimation
 	FExText_GlyphAnimation( UExpressiveTextAnimation* Anim)
 		: Animation(Anim)
 	{}
+
+	bool operator==(const FExText_GlyphAnimation& Other) const
+	{
+		return Animation == Other.Animation && Reverse == Other.Reverse;
+	}
+
+	friend uint32 GetTypeHash(const FExText_GlyphAnimation& GlyphAnimation)
+	{
+		return HashCombine(GetTypeHash(GlyphAnimation.Animation), GetTypeHash(GlyphAnimation.Reverse));
+	}
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Animation, meta = (Tooltip = "Glyph animation we're going to play" ) )
 	UExpressiveTextAnimation* Animation;
@@ -230,12 +240,28 @@ public:
 		: Super()
 		, CombinedMaterial()
 		, MaterialsChecksum(0)
+		, LayerStackHash(0)
 	{
 	}
 
 
 	virtual void GetMaterials(TArray<UExpressiveTextMaterial*>& OutMaterials) const { check(false); }
 
+	bool RequiresDynamicParameter(EExTextDynamicMaterialParameters Parameter) const
+	{
+		if (!CombinedMaterial)
+		{
+			return false;
+		}
+
+		TArray<UExpressiveTextMaterial*> Materials;
+		GetMaterials(Materials);
+
+		return Materials.ContainsByPredicate([Parameter](const UExpressiveTextMaterial* Material) {
+			return Material && Material->RequiresDynamicParameter(Parameter);
+		});
+	}
+
 #if WITH_EDITOR
 
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& Event) override
@@ -245,7 +271,8 @@ public:
 		TArray<UExpressiveTextMaterial*> Materials;
 		GetMaterials(Materials);
 
-		MaterialGeneration::ReconstructCombinedMaterial(this, CombinedMaterial, Materials);
+		// Only edits that change the layer stack regenerate the combined material
+		MaterialGeneration::ReconstructCombinedMaterial(this, CombinedMaterial, Materials, true, &LayerStackHash);
 		
 		MaterialsChecksum = 0;
 		for (int32 i = 0; i < Materials.Num(); i++)
@@ -267,6 +294,10 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = MaterialBase)
 	int64 MaterialsChecksum;
+
+	// Layer stack CombinedMaterial was generated from, see MaterialGeneration::HashLayerStack
+	UPROPERTY()
+	uint32 LayerStackHash;
 };
 
 //-----------------------------------------------------------------------
@@ -625,6 +656,28 @@ public:
 
 //-----------------------------------------------------------------------
 
+UCLASS(meta = (DisplayName = "Evaluate Animation On GPU"))
+class EXPRESSIVETEXT_API UExTextValue_EvaluateAnimationOnGPU : public UExpressiveTextParameterValue
+{
+	GENERATED_BODY()
+
+public:
+	CATEGORY(RevealAnimation)
+	using ValueType = bool;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = EvaluateAnimationOnGPU, meta = (Tooltip = "Bakes the reveal/clear animation curves into a texture so a material using the 'Glyph Animation' dynamic parameter can animate each glyph. Runs with interjections, per character actions or no such material layer fall back to CPU evaluation"))
+	bool Value;
+
+#if WITH_EDITOR
+	virtual FString MoreInfoTooltip() const override
+	{
+		return TEXT("[icon,gold](warning) Requires the patched slate shaders and a material layer reading the baked glyph animation curves. Without one the run falls back to the CPU animation");
+	}
+#endif
+};
+
+//-----------------------------------------------------------------------
+
 UCLASS(meta = (DisplayName = "Percentage Offset"))
 class EXPRESSIVETEXT_API UExTextValue_PercentageOffset : public UExpressiveTextParameterValue
 {
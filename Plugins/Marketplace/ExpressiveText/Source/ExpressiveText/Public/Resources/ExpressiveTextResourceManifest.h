@@ -0,0 +1,42 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <UObject/PrimaryAssetId.h>
+#include <UObject/SoftObjectPath.h>
+
+#include "ExpressiveTextResourceManifest.generated.h"
+
+// List of every resource a text needs to be displayed, recorded at save time so it can be loaded in a single batch
+USTRUCT( BlueprintType )
+struct EXPRESSIVETEXT_API FExpressiveTextResourceManifest
+{
+	GENERATED_BODY()
+
+	FExpressiveTextResourceManifest()
+		: PrimaryAssets()
+		, Materials()
+	{}
+
+	static FExpressiveTextResourceManifest FromResources( const TArray<UObject*>& Resources );
+
+	bool IsEmpty() const
+	{
+		return PrimaryAssets.Num() == 0 && Materials.Num() == 0;
+	}
+
+	void Append( const FExpressiveTextResourceManifest& Other );
+	void GatherSoftObjectPaths( TArray<FSoftObjectPath>& OutPaths ) const;
+
+	// Styles, fonts and animations referenced through tags
+	UPROPERTY( VisibleAnywhere, BlueprintReadOnly, Category = ExpressiveText )
+	TArray<FPrimaryAssetId> PrimaryAssets;
+
+	// Combined materials used by the referenced styles
+	UPROPERTY( VisibleAnywhere, BlueprintReadOnly, Category = ExpressiveText )
+	TArray<FSoftObjectPath> Materials;
+
+private:
+	void AddResource( UObject* Resource );
+};
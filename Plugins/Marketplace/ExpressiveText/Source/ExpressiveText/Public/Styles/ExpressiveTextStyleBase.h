@@ -27,18 +27,26 @@ public:
 		: Super( )
 		, Parameters()
 		, Cache( MakeShareable( new FExpressiveTextParameterCache ) )
+		, FlattenedCache( MakeShareable( new FExpressiveTextParameterCache ) )
+		, Version( 0 )
+		, Dependents()
 	{}
 
 #if WITH_EDITOR	
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override
 	{
 		Super::PostEditChangeProperty(PropertyChangedEvent);
+		SanitizeInheritedStyles();
+
 		if (PropertyChangedEvent.Property && PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UExpressiveTextStyleBase, Parameters))
 		{
 			RebuildCache();
 		}
+		else
+		{
+			RebuildFlattenedCache();
+		}
 
-		SanitizeInheritedStyles();
 		OnPostEditChangeCalled.Broadcast();
 	}
 #endif
@@ -62,32 +70,27 @@ public:
 		}
 	}
 
+	// Single lookup over the flattened parameters of this style and everything it inherits from.
+	// The returned node is new (callers chain onto it) but the parameter set behind it is shared.
 	virtual TSharedPtr<FExpressiveTextParameterLookup> GetParameterLookup() const override
-	{		
-		auto WeakCache = TWeakPtr< FExpressiveTextParameterCache >(Cache);
+	{
+		auto WeakCache = TWeakPtr< FExpressiveTextParameterCache >(FlattenedCache);
 		TSharedPtr<IExpressiveTextParameterExtractor> Extractor = MakeShareable(new FExpressiveTextCacheParameterExtractor( WeakCache ));
-		TSharedPtr<FExpressiveTextParameterLookup> Root = MakeShareable(new FExpressiveTextParameterLookup( GetDescriptor(), Extractor ));
-
-		for( int32 i = InheritedStyles.Num() - 1; i >= 0; i-- )
-		{
-			auto* InheritedStyle = InheritedStyles[i];
-
-			if( InheritedStyle )
-			{
-				auto InheritedStyleLookup = InheritedStyle->GetParameterLookup();
-				Root->SetNext(InheritedStyleLookup);
-			}
-		}
-
-		return Root;
+		return MakeShareable(new FExpressiveTextParameterLookup( GetDescriptor(), Extractor ));
 	}
 
+	// Bumped whenever the effective parameters of this style change, including changes coming from inherited styles.
+	// Lookups share the parameter set, so anything cached from a compile keys on this (see FExpressiveTextFields::CalcChecksum)
+	uint32 GetVersion() const
+	{
+		return Version;
+	}
 
 	virtual void PostLoad() override
 	{
 		Super::PostLoad();
-		RebuildCache();
 		SanitizeInheritedStyles();
+		RebuildCache();
 	}
 
 	virtual FName GetDescriptor() const
@@ -156,7 +159,45 @@ private:
 				Cache->Add( *Value );
 			}
 		}
+
+		RebuildFlattenedCache();
+	}
+
+	// Refilled in place so lookups handed out earlier see the new values, then propagated to every style inheriting from this one
+	void RebuildFlattenedCache()
+	{
+		FlattenedCache->Empty();
+
+		// Later inherited styles take priority over earlier ones and the style's own parameters take priority over all of them
+		for( auto* InheritedStyle : InheritedStyles )
+		{
+			if( InheritedStyle && InheritedStyle != this )
+			{
+				InheritedStyle->Dependents.AddUnique( this );
+				FlattenedCache->Append( *InheritedStyle->FlattenedCache );
+			}
+		}
+
+		FlattenedCache->Append( *Cache );
+		Version++;
+
+		Dependents.RemoveAll( []( const TWeakObjectPtr<UExpressiveTextStyleBase>& Dependent ) { return !Dependent.IsValid(); } );
+
+		// Copy as dependents register themselves again while rebuilding
+		const TArray<TWeakObjectPtr<UExpressiveTextStyleBase>> DependentsToRebuild = Dependents;
+		for( const auto& Dependent : DependentsToRebuild )
+		{
+			if( Dependent.IsValid() && Dependent->InheritedStyles.Contains( this ) )
+			{
+				Dependent->RebuildFlattenedCache();
+			}
+		}
 	}
 
 	TSharedRef<FExpressiveTextParameterCache> Cache;
+
+	// Own parameters merged over the ones of inherited styles
+	TSharedRef<FExpressiveTextParameterCache> FlattenedCache;
+	uint32 Version;
+	TArray<TWeakObjectPtr<UExpressiveTextStyleBase>> Dependents;
 };
\ No newline at end of file
@@ -5,10 +5,14 @@
 #include <CoreMinimal.h>
 
 #include "Styles/ExpressiveTextStyle.h"
+#include "Compiled/ExTextCompileScheduler.h"
+#include "Layout/ExTextGlyphShapingCache.h"
 #include "Layout/ExTextMIDCache.h"
 #include "Resources/ExpressiveTextResources.h"
+#include "Resources/ExpressiveTextResourceManifest.h"
 
 #include <Engine/AssetManager.h>
+#include <Guganana/Async.h>
 #include <Subsystems/EngineSubsystem.h>
 
 #if UE_VERSION_OLDER_THAN( 5, 1, 0 )
@@ -20,6 +24,20 @@
 #include "ExpressiveTextSubsystem.generated.h"
 
 class UExpressiveTextAnimation;
+class UExpressiveTextAsset;
+
+struct FExTextInternStats
+{
+	FExTextInternStats()
+		: Requests(0)
+		, Hits(0)
+	{}
+
+	// Every inline value requested by the compiler
+	int32 Requests;
+	// Requests served by an existing instance, each one a parameter object GC no longer has to deal with
+	int32 Hits;
+};
 
 UCLASS()
 class EXPRESSIVETEXT_API UExpressiveTextSubsystem 
@@ -44,6 +62,12 @@ public:
 			return TOptional<TFuture<T*>>();
 		}
 
+		// Resources warmed up through a manifest don't need to go through the streamable manager again
+		if (UObject* LoadedAsset = Manager.GetPrimaryAssetObject(AssetId))
+		{
+			return Guganana::Async::MakeFullfiledFuture<T*>(Cast<T>(LoadedAsset));
+		}
+
 		TArray<FName> Unused;
 		auto LoadHandle = Manager.PreloadPrimaryAssets({ AssetId }, Unused, false);
 
@@ -78,6 +102,16 @@ public:
 
 		return Assets;
 	}
+
+	// Loads every resource listed in the manifest through a single async request.
+	// The resources stay loaded while the caller holds OutHandle, which is left empty when everything was loaded already.
+	TFuture<void> PreloadManifest(const FExpressiveTextResourceManifest& Manifest, TSharedPtr<FStreamableHandle>& OutHandle);
+
+	// Warms the resources of a whole set of texts (i.e. a dialogue tree) ahead of display, they stay loaded until ReleaseWarmedResources
+	TFuture<void> WarmTexts(const TArray<UExpressiveTextAsset*>& Assets);
+
+	// Lets go of resources kept alive by previous WarmTexts calls
+	void ReleaseWarmedResources();
 	
 	DECLARE_EVENT_TwoParams( UExpressiveTextSubsystem, FExpressiveTextMissingFont, FName, TOptional<FString>)
 	FExpressiveTextMissingFont& OnMissingFont()
@@ -90,6 +124,64 @@ public:
 		return MIDCache.RequestMID( Request );
 	}
 
+	const FExTextMIDCache& GetMIDCache() const
+	{
+		return MIDCache;
+	}
+
+	FExTextGlyphShapingCache& GetGlyphShapingCache()
+	{
+		return GlyphShapingCache;
+	}
+
+	FExTextCompileScheduler& GetCompileScheduler()
+	{
+		return CompileScheduler;
+	}
+
+	// Returns a shared parameter value object for inline tags (#hex, Npt, Nrr, *typeface...) so compiles don't allocate one per tag.
+	// Interned instances are shared between every text using them and must never be modified.
+	// The table only holds them weakly, the compiled texts using a value keep it alive and it is collected with the last of them.
+	template< typename ValueObjectType, typename ValueType = typename ValueObjectType::ValueType >
+	ValueObjectType* InternParameterValue(const ValueType& Value)
+	{
+		InternStats.Requests++;
+		TryPurgeInternedValues();
+
+		const FInternedValueKey Key(ValueObjectType::StaticClass(), GetTypeHash(Value));
+
+		TArray<TWeakObjectPtr<UExpressiveTextParameterValue>> Candidates;
+		InternedValuesLookup.MultiFind(Key, Candidates);
+		for (const auto& Candidate : Candidates)
+		{
+			auto* TypedCandidate = Cast<ValueObjectType>(Candidate.Get());
+			if (TypedCandidate && TypedCandidate->Value == Value)
+			{
+				InternStats.Hits++;
+				return TypedCandidate;
+			}
+		}
+
+		ValueObjectType* ValueObject = NewObject<ValueObjectType>(this);
+		ValueObject->Value = Value;
+
+		InternedValuesLookup.Add(Key, ValueObject);
+		return ValueObject;
+	}
+
+	// Drops the entries of interned values that were garbage collected
+	void TryPurgeInternedValues();
+
+	const FExTextInternStats& GetInternStats() const
+	{
+		return InternStats;
+	}
+
+	int32 GetNumInternedValues() const
+	{
+		return InternedValuesLookup.Num();
+	}
+
 	
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(BlueprintReadOnly, Category = ExpressiveText)
@@ -107,6 +199,15 @@ private:
 	FExpressiveTextMissingFont ExpressiveTextMissingFont;
 	TMap<FName, FColor> ColorMap;
 	FExTextMIDCache MIDCache;
+	FExTextGlyphShapingCache GlyphShapingCache;
+	FExTextCompileScheduler CompileScheduler;
+	TArray<TSharedPtr<FStreamableHandle>> WarmedHandles;
+
+	using FInternedValueKey = TPair<const UClass*, uint32>;
+
+	TMultiMap<FInternedValueKey, TWeakObjectPtr<UExpressiveTextParameterValue>> InternedValuesLookup;
+	FExTextInternStats InternStats;
+	double LastInternPurgeTimestamp = 0.0;
 
 	//populates color map based on CSS/HTML color names
 	void PopulateColorMap();
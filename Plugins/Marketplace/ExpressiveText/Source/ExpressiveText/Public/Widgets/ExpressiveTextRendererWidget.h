@@ -42,6 +42,22 @@ public:
 		}
 	}
 
+	void AppendExpressiveText( FExpressiveText& Text, const FString& NewLines )
+	{
+		if (Renderer)
+		{
+			Renderer->AppendExpressiveText(Text, NewLines);
+		}
+	}
+
+	void SetTemplateValue( FExpressiveText& Text, const FName& Key, const FString& Value )
+	{
+		if (Renderer)
+		{
+			Renderer->SetTemplateValue(Text, Key, Value);
+		}
+	}
+
 	void SkipReveal()
 	{
 		if(Renderer)
@@ -56,5 +72,16 @@ public:
 		Renderer->GetChronos(OutChronos);
 	}
 
+	bool FindGlyphAt( const FVector2D& ScreenPosition, FExpressiveTextGlyphInformation& OutGlyph ) const
+	{
+		if (!Renderer)
+		{
+			OutGlyph = FExpressiveTextGlyphInformation();
+			return false;
+		}
+
+		return Renderer->FindGlyphAt(GetCachedGeometry(), ScreenPosition, OutGlyph);
+	}
+
 	TSharedPtr<SExpressiveTextRendererWidget> Renderer;
 };
@@ -12,6 +12,8 @@
 
 #include "ExpressiveTextWidget.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnExpressiveTextGlyphHovered, const FExpressiveTextGlyphInformation&, Glyph);
+
 UCLASS()
 class EXPRESSIVETEXT_API UExpressiveTextWidget : public UUserWidget
 {
@@ -21,6 +23,14 @@ public:
 
 	UFUNCTION( BlueprintCallable, Category = ExpressiveText, meta=( DisplayName = "Display Text (Internal use only!)") )
 	void DisplayText( UPARAM(ref) FExpressiveText& Text );
+
+	// Adds lines to the displayed text without recompiling the lines already shown, for chat logs and subtitles
+	UFUNCTION( BlueprintCallable, Category = ExpressiveText )
+	void AppendText( UPARAM(ref) FExpressiveText& Text, const FString& NewLines );
+
+	// Swaps the value of a {Key} placeholder in the displayed text, only the lines holding it are shaped again
+	UFUNCTION( BlueprintCallable, Category = ExpressiveText )
+	void SetTemplateValue( UPARAM(ref) FExpressiveText& Text, FName Key, const FString& Value );
 	
 	UFUNCTION( BlueprintCallable, Category = ExpressiveText )
 	void SkipReveal()
@@ -40,12 +50,27 @@ public:
 
 	void Clear();
 
+	// Fires when the glyph under the mouse changes, with an invalid glyph once the mouse leaves the text
+	UPROPERTY(BlueprintAssignable, Category = ExpressiveText)
+	FOnExpressiveTextGlyphHovered OnGlyphHovered;
+
+	UFUNCTION(BlueprintPure, Category = ExpressiveText)
+	const FExpressiveTextGlyphInformation& GetHoveredGlyph() const
+	{
+		return HoveredGlyph;
+	}
+
 protected:
 
 	virtual void NativePreConstruct() override;
+	virtual FReply NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual void NativeOnMouseLeave(const FPointerEvent& InMouseEvent) override;
+
+	void SetHoveredGlyph(const FExpressiveTextGlyphInformation& Glyph);
 
 	UPROPERTY(BlueprintReadOnly, Category = ExpressiveText, meta = (BindWidget))
 	UExpressiveTextRendererWidget* Renderer;
 private:
 
+	FExpressiveTextGlyphInformation HoveredGlyph;
 };
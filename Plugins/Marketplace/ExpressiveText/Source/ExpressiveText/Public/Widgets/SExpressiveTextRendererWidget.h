@@ -43,6 +43,9 @@ public:
 		, CompiledText()
 		, TextLayout( MakeShareable( new FExpressiveTextSlateLayout ) )
 		, UsedInEditor(false)
+		, IsCompiling(false)
+		, PendingAppendedLines()
+		, LastPaintFrame(0)
 	{
 	}
 
@@ -83,6 +86,8 @@ public:
 			return 0;
 		}
 
+		LastPaintFrame = GFrameCounter;
+
 		float DesiredWrapingWidth = CalcDesiredWrappingWidth(DrawSize);
 		CommitWrappingWidth( DesiredWrapingWidth );
 
@@ -90,11 +95,21 @@ public:
 		
 		if(TextLayout->GetWrappingWidth() >= 0.f)
 		{
+			if (TextLayout->IsVirtualized())
+			{
+				// Move the materialized lines to whatever part of the document the culling rect shows
+				const FVector2D TextPosition = CompiledText.GetValue().Alignment.CalculateDesiredPosition(DrawSize, TextLayout->GetVirtualSize());
+				const float VisibleTop = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopLeft()).Y - TextPosition.Y;
+				const float VisibleBottom = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomRight()).Y - TextPosition.Y;
+				TextLayout->UpdateVirtualWindow(VisibleTop, VisibleBottom);
+			}
+
 			TextLayout->UpdateIfNeeded();
 
-			TextLayout->GetSharedData()->AlignmentOffset = CompiledText.GetValue().Alignment.CalculateDesiredPosition(DrawSize, TextLayout->GetSize());
+			TextLayout->GetSharedData()->AlignmentOffset = CompiledText.GetValue().Alignment.CalculateDesiredPosition(DrawSize, GetTextSize()) + FVector2D(0.f, TextLayout->GetVirtualTopOffset());
 
-			if (CompiledText->UseAutoSize)
+			// Auto size would need every line laid out, virtualized texts keep their font size
+			if (CompiledText->UseAutoSize && !TextLayout->IsVirtualized())
 			{
 				FVector2D AutoSizeArea = FVector2D(CalcAutoSizeWidth(DrawSize), DrawSize.Y);
 				TextLayout->ApplyAutoSize(AutoSizeArea);
@@ -113,7 +128,7 @@ public:
 		{
 			TextLayout->SetScale(LayoutScaleMultiplier);
 			TextLayout->UpdateIfNeeded();
-			return TextLayout->GetSize();
+			return GetTextSize();
 		}
 
 		return FVector2D::ZeroVector;
@@ -124,6 +139,16 @@ public:
 		return CompiledText.IsSet();
 	}
 
+	const TOptional<FCompiledExpressiveText>& GetCompiledText() const
+	{
+		return CompiledText;
+	}
+
+	FVector2D GetTextSize() const
+	{
+		return TextLayout->IsVirtualized() ? TextLayout->GetVirtualSize() : TextLayout->GetSize();
+	}
+
 	virtual FChildren* GetChildren() override
 	{
 		if (HasText())
@@ -143,32 +168,98 @@ public:
 
 			CommitWrappingWidth( CalcDesiredWrappingWidth(DrawSize) );
 
-			FVector2D StartPos = CompiledText.GetValue().Alignment.CalculateDesiredPosition(DrawSize, TextLayout->GetSize());
+			FVector2D StartPos = CompiledText.GetValue().Alignment.CalculateDesiredPosition(DrawSize, GetTextSize()) + FVector2D(0.f, TextLayout->GetVirtualTopOffset());
 			TextLayout->ArrangeChildren(AllottedGeometry.MakeChild(FSlateRenderTransform(StartPos)), ArrangedChildren);
 		}
 	}
 
 	void SetExpressiveText( FExpressiveText& Text )
 	{
-		TextLayout->ClearLines();
+		TextLayout->ResetLines();
 		Text.SetTextLayout( TextLayout );
+		PendingAppendedLines.Empty();
+		IsCompiling = true;
+
+		// Compiles requested before the layout was reset again are superseded, only the latest one lands
+		const uint32 LinesGeneration = TextLayout->GetLinesGeneration();
 
 		TWeakPtr<SExpressiveTextRendererWidget> WeakThisPtr( StaticCastSharedRef<SExpressiveTextRendererWidget>(AsShared()) );
-		UExpressiveTextProcessor::CompileText(Text).Next(
-			[WeakThisPtr](const FCompiledExpressiveText& InCompiledText)
+		UExpressiveTextProcessor::CompileText(Text, GetCompilePriority()).Next(
+			[WeakThisPtr, Text, LinesGeneration](const FCompiledExpressiveText& InCompiledText)
 			{
-				if ( auto* RawThis = WeakThisPtr.Pin().Get() )
+				auto* RawThis = WeakThisPtr.Pin().Get();
+				if ( RawThis && RawThis->TextLayout->GetLinesGeneration() == LinesGeneration )
 				{
 					RawThis->CompiledText = InCompiledText;
 					RawThis->TextLayout->AggregateChildren();
 					RawThis->TextLayout->GetSharedData()->Chronos.UpdateStartTime();
 					RawThis->TextLayout->GetSharedData()->Chronos.UpdateCurrentTime();
 					RawThis->TextLayout->ResetAutoSizeCache();
+					RawThis->OnCompileFinished(Text);
 				}
 			}
 		);
 	}
 
+	// Adds lines after the ones already displayed, only the new lines are compiled and the reveal of the current ones is kept.
+	// Lines over the history limit of the text are evicted from the front.
+	void AppendExpressiveText( FExpressiveText& Text, const FString& NewLines )
+	{
+		// Appends wait for the compile in flight, they are added in order once it lands
+		if (IsCompiling && &Text.GetTextLayout().Get() == &TextLayout.Get())
+		{
+			PendingAppendedLines.Add(NewLines);
+			return;
+		}
+
+		Text.AppendText(NewLines);
+
+		// Virtualized layouts keep every line of the document, they are compiled again as a whole
+		if (!HasText() || &Text.GetTextLayout().Get() != &TextLayout.Get() || TextLayout->IsVirtualized())
+		{
+			SetExpressiveText(Text);
+			return;
+		}
+
+		IsCompiling = true;
+
+		const uint32 LinesGeneration = TextLayout->GetLinesGeneration();
+
+		TWeakPtr<SExpressiveTextRendererWidget> WeakThisPtr( StaticCastSharedRef<SExpressiveTextRendererWidget>(AsShared()) );
+		UExpressiveTextProcessor::CompileAppendedText(Text, NewLines, GetCompilePriority()).Next(
+			[WeakThisPtr, Text, LinesGeneration](const FCompiledExpressiveText& InCompiledText)
+			{
+				auto* RawThis = WeakThisPtr.Pin().Get();
+				if ( RawThis && RawThis->TextLayout->GetLinesGeneration() == LinesGeneration )
+				{
+					RawThis->CompiledText = InCompiledText;
+					RawThis->TextLayout->AggregateChildren();
+					RawThis->TextLayout->ResetAutoSizeCache();
+					RawThis->OnCompileFinished(Text);
+				}
+			}
+		);
+	}
+
+	// Changes a template value of the displayed text without compiling it again, only the lines holding the value are shaped again.
+	// New keys change which braces are placeholders so the text is compiled again for those.
+	void SetTemplateValue( FExpressiveText& Text, const FName& Key, const FString& Value )
+	{
+		const bool IsNewKey = !Text.GetTemplateDictionary().Contains(Key);
+		Text.AddTemplateValue(Key, Value);
+
+		const bool CanPatch = !IsNewKey && !IsCompiling && HasText() && &Text.GetTextLayout().Get() == &TextLayout.Get();
+		if (!CanPatch || !UExpressiveTextProcessor::ApplyTemplateValue(Text, Key, Value))
+		{
+			SetExpressiveText(Text);
+			return;
+		}
+
+		TextLayout->AggregateChildren();
+		TextLayout->ResetAutoSizeCache();
+		CompiledText->DrawSize = TextLayout->GetDrawSize();
+	}
+
 	void Reset()
 	{
 		TextLayout->GetSharedData()->Chronos.UpdateStartTime();
@@ -185,13 +276,64 @@ public:
 		OutChronos = TextLayout->GetSharedData()->Chronos;
 	}
 
+	bool FindGlyphAt(const FGeometry& Geometry, const FVector2D& ScreenPosition, FExpressiveTextGlyphInformation& OutGlyph) const
+	{
+		if (!HasText())
+		{
+			OutGlyph = FExpressiveTextGlyphInformation();
+			return false;
+		}
+
+		return FExpressiveText::FindGlyphInLayout(TextLayout.Get(), Geometry.AbsoluteToLocal(ScreenPosition), 1.f, OutGlyph);
+	}
+
 
 private:
 
+	// Texts inside the focused widget (i.e. the selected dialogue option) compile first, then the ones on screen
+	EExTextCompilePriority GetCompilePriority() const
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			if (TSharedPtr<SWidget> FocusedWidget = FSlateApplication::Get().GetKeyboardFocusedWidget())
+			{
+				for (const SWidget* Widget = this; Widget; Widget = Widget->GetParentWidget().Get())
+				{
+					if (Widget == FocusedWidget.Get())
+					{
+						return EExTextCompilePriority::Focused;
+					}
+				}
+			}
+		}
+
+		// Texts that haven't been painted yet are about to be shown for the first time
+		const bool PaintedRecently = LastPaintFrame == 0 || GFrameCounter - LastPaintFrame <= 1;
+		return GetVisibility().IsVisible() && PaintedRecently ? EExTextCompilePriority::Visible : EExTextCompilePriority::Background;
+	}
+
+	void OnCompileFinished( FExpressiveText Text )
+	{
+		IsCompiling = false;
+
+		if (PendingAppendedLines.Num() > 0)
+		{
+			const FString NewLines = FString::Join(PendingAppendedLines, TEXT("\n"));
+			PendingAppendedLines.Empty();
+			AppendExpressiveText(Text, NewLines);
+		}
+	}
+
 	void CommitWrappingWidth( float value ) const
 	{
 		// Value is 0 when no wrapping is set
 		value = FMath::Max(0.f, value);
+
+		if (TextLayout->IsVirtualized() && TextLayout->GetWrappingWidth() != value)
+		{
+			TextLayout->InvalidateVirtualLineHeights();
+		}
+
 		TextLayout->SetWrappingWidth(value);
 	}
 
@@ -199,4 +341,7 @@ private:
 	TOptional<FCompiledExpressiveText> CompiledText;
 	TSharedRef<FExpressiveTextSlateLayout> TextLayout;
 	TAttribute<bool> UsedInEditor;
+	bool IsCompiling;
+	TArray<FString> PendingAppendedLines;
+	mutable uint64 LastPaintFrame;
 };
@@ -76,6 +76,7 @@ public class ExpressiveTextEditor : ModuleRules
 			{
 				"EditorWidgets",
 				"SlateCore",
+				"SlateNullRenderer",
 				"Engine"
 			}
 		);
@@ -0,0 +1,280 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#include "ExpressiveTextBenchmarkCommandlet.h"
+
+#include <ExpressiveText/Public/Handles/ExpressiveText.h>
+#include <ExpressiveText/Public/Subsystems/ExpressiveTextSubsystem.h>
+#include <ExpressiveText/Public/Widgets/SExpressiveTextRendererWidget.h>
+
+#include <Editor.h>
+#include <Framework/Application/SlateApplication.h>
+#include <Guganana/Logging.h>
+#include <Input/HittestGrid.h>
+#include <Interfaces/ISlateNullRendererModule.h>
+#include <Misc/App.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Modules/ModuleManager.h>
+#include <Rendering/DrawElements.h>
+#include <UObject/UObjectArray.h>
+#include <Widgets/SWindow.h>
+
+namespace ExpressiveTextBenchmark
+{
+	struct FCorpusEntry
+	{
+		FString Name;
+		FString Text;
+		bool Virtualized = false;
+	};
+
+	struct FSample
+	{
+		double CompileTime = 0.0;
+		double FirstPaintTime = 0.0;
+		double PaintTime = 0.0;
+		int32 Runs = 0;
+		int32 NewMIDs = 0;
+		int32 NewObjects = 0;
+	};
+
+	static const TCHAR* Words[] = {
+		TEXT("the"), TEXT("quick"), TEXT("brown"), TEXT("fox"), TEXT("jumps"), TEXT("over"), TEXT("lazy"), TEXT("dog"),
+		TEXT("ancient"), TEXT("sword"), TEXT("whispers"), TEXT("beneath"), TEXT("silver"), TEXT("moon"), TEXT("traveler"), TEXT("gold")
+	};
+
+	static const TCHAR* Tags[] = {
+		TEXT("red"), TEXT("#ff8800"), TEXT("24pt"), TEXT("skyblue"), TEXT("#33cc66"), TEXT("32pt"), TEXT("gold"), TEXT("16pt")
+	};
+
+	static FString MakeLines(FRandomStream& Random, int32 NumLines, int32 WordsPerLine, TFunctionRef<FString(const FString&, int32)> DecorateWord)
+	{
+		TArray<FString> Lines;
+		for (int32 LineIndex = 0; LineIndex < NumLines; LineIndex++)
+		{
+			TArray<FString> LineWords;
+			for (int32 WordIndex = 0; WordIndex < WordsPerLine; WordIndex++)
+			{
+				const FString Word = Words[Random.RandRange(0, UE_ARRAY_COUNT(Words) - 1)];
+				LineWords.Add(DecorateWord(Word, WordIndex));
+			}
+
+			Lines.Add(FString::Join(LineWords, TEXT(" ")));
+		}
+
+		return FString::Join(Lines, TEXT("\n"));
+	}
+
+	// Same seed every run so every version benchmarks the exact same texts
+	static TArray<FCorpusEntry> MakeCorpus()
+	{
+		FRandomStream Random(1337);
+		TArray<FCorpusEntry> Corpus;
+
+		Corpus.Add({ TEXT("Plain"), MakeLines(Random, 8, 12, [](const FString& Word, int32) { return Word; }) });
+
+		Corpus.Add({ TEXT("TagDense"), MakeLines(Random, 8, 12,
+			[](const FString& Word, int32 WordIndex)
+			{
+				return FString::Printf(TEXT("[%s](%s)"), Tags[WordIndex % UE_ARRAY_COUNT(Tags)], *Word);
+			}
+		) });
+
+		Corpus.Add({ TEXT("NestedStyles"), MakeLines(Random, 8, 6,
+			[](const FString& Word, int32 WordIndex)
+			{
+				const int32 TagIndex = WordIndex % UE_ARRAY_COUNT(Tags);
+				return FString::Printf(TEXT("[%s]([%s]([%s](%s) %s) %s)"), Tags[TagIndex], Tags[(TagIndex + 2) % UE_ARRAY_COUNT(Tags)], Tags[(TagIndex + 5) % UE_ARRAY_COUNT(Tags)], *Word, *Word, *Word);
+			}
+		) });
+
+		Corpus.Add({ TEXT("Interjections"), MakeLines(Random, 8, 12,
+			[](const FString& Word, int32)
+			{
+				return Word + TEXT("<pause:0.05>");
+			}
+		) });
+
+		const FString LongDocument = MakeLines(Random, 400, 12, [](const FString& Word, int32) { return Word; });
+		Corpus.Add({ TEXT("LongDocument"), LongDocument });
+		Corpus.Add({ TEXT("LongDocumentVirtualized"), LongDocument, true });
+
+		return Corpus;
+	}
+
+	// Commandlets don't bring up Slate, text shaping and layout only need it with a renderer that draws nothing
+	static void EnsureSlateApplication()
+	{
+		if (!FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Create();
+			TSharedRef<FSlateRenderer> Renderer = FModuleManager::Get().LoadModuleChecked<ISlateNullRendererModule>("SlateNullRenderer").CreateSlateNullRenderer();
+			FSlateApplication::Get().InitializeRenderer(Renderer);
+		}
+	}
+
+	static int32 CountRuns(const FExpressiveTextSlateLayout& Layout)
+	{
+		int32 NumRuns = 0;
+		for (const auto& LineModel : Layout.GetLineModels())
+		{
+			NumRuns += LineModel.Runs.Num();
+		}
+
+		return NumRuns;
+	}
+}
+
+UExpressiveTextBenchmarkCommandlet::UExpressiveTextBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExpressiveTextBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace ExpressiveTextBenchmark;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const auto IntParam = [&ParamValues](const TCHAR* Name, int32 Default)
+	{
+		const FString* Value = ParamValues.Find(Name);
+		return Value ? FMath::Max(1, FCString::Atoi(**Value)) : Default;
+	};
+
+	const int32 Iterations = IntParam(TEXT("Iterations"), 5);
+	const int32 Frames = IntParam(TEXT("Frames"), 60);
+	const FVector2D ViewportSize(IntParam(TEXT("Width"), 1280), IntParam(TEXT("Height"), 720));
+
+	const FString* OutputParam = ParamValues.Find(TEXT("Output"));
+	const FString OutputPath = OutputParam ? *OutputParam : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ExpressiveText"), TEXT("Benchmark.csv"));
+
+	EnsureSlateApplication();
+
+	auto* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UExpressiveTextSubsystem>() : nullptr;
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!Subsystem || !World)
+	{
+		Unlog::Errorf(TEXT("ExpressiveTextBenchmark: Requires the engine subsystem and an editor world"));
+		return 1;
+	}
+
+	// Fixed frame times so the reveal progresses the same way on every machine
+	static constexpr double FrameDelta = 1.0 / 60.0;
+	static constexpr int32 MaxCompilePumps = 10000;
+
+	const FGeometry Geometry = FGeometry::MakeRoot(ViewportSize, FSlateLayoutTransform());
+	const FSlateRect CullingRect(FVector2D::ZeroVector, ViewportSize);
+	TSharedRef<SWindow> Window = SNew(SWindow);
+	FSlateWindowElementList ElementList(Window);
+	FHittestGrid HittestGrid;
+
+	TArray<FString> CsvLines;
+	CsvLines.Add(TEXT("Name,Characters,Lines,Iterations,CompileMsAvg,CompileMsMin,FirstPaintMsAvg,PaintMsAvg,Runs,NewMIDs,NewObjects"));
+
+	for (const FCorpusEntry& Entry : MakeCorpus())
+	{
+		TArray<FSample> Samples;
+
+		TArray<FString> Lines;
+		const int32 NumLines = Entry.Text.ParseIntoArrayLines(Lines, false);
+
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			// Each sample counts as its own frame so it gets the whole compile budget
+			GFrameCounter++;
+			FApp::SetCurrentTime(GStartTime);
+			FApp::SetDeltaTime(FrameDelta);
+
+			TSharedRef<SExpressiveTextRendererWidget> Widget = SNew(SExpressiveTextRendererWidget);
+
+			FExpressiveText Text;
+			Text.SetWorldContext(World);
+			Text.SetText(FText::FromString(Entry.Text));
+			Text.SetVirtualized(Entry.Virtualized);
+
+			FSample& Sample = Samples.AddDefaulted_GetRef();
+			const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+			const int32 MIDsBefore = Subsystem->GetMIDCache().Num();
+
+			double StartTime = FPlatformTime::Seconds();
+			Widget->SetExpressiveText(Text);
+
+			// Resources and compiles spread over frames finish through async loading and the scheduler tick
+			for (int32 Pump = 0; !Widget->HasText() && Pump < MaxCompilePumps; Pump++)
+			{
+				FlushAsyncLoading();
+				GFrameCounter++;
+				Subsystem->GetCompileScheduler().Tick(FrameDelta);
+			}
+
+			Sample.CompileTime = FPlatformTime::Seconds() - StartTime;
+
+			if (!Widget->HasText())
+			{
+				Unlog::Errorf(TEXT("ExpressiveTextBenchmark: %s never finished compiling"), *Entry.Name);
+				return 1;
+			}
+
+			const FPaintArgs PaintArgs(&Window.Get(), HittestGrid, FVector2D::ZeroVector, FApp::GetCurrentTime(), FrameDelta);
+
+			// First paint also lays out the text for the wrapping width of the viewport
+			StartTime = FPlatformTime::Seconds();
+			Widget->OnPaint(PaintArgs, Geometry, CullingRect, ElementList, 0, FWidgetStyle(), true);
+			Sample.FirstPaintTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 1; Frame <= Frames; Frame++)
+			{
+				FApp::SetCurrentTime(GStartTime + Frame * FrameDelta);
+				ElementList.ResetElementList();
+				Widget->OnPaint(PaintArgs, Geometry, CullingRect, ElementList, 0, FWidgetStyle(), true);
+			}
+			Sample.PaintTime = (FPlatformTime::Seconds() - StartTime) / Frames;
+			ElementList.ResetElementList();
+
+			Sample.Runs = CountRuns(Text.GetTextLayout().Get());
+			Sample.NewMIDs = Subsystem->GetMIDCache().Num() - MIDsBefore;
+			Sample.NewObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+		}
+
+		// Don't let parameter objects and MIDs of this entry count towards the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		double CompileTotal = 0.0;
+		double CompileMin = TNumericLimits<double>::Max();
+		double FirstPaintTotal = 0.0;
+		double PaintTotal = 0.0;
+		for (const FSample& Sample : Samples)
+		{
+			CompileTotal += Sample.CompileTime;
+			CompileMin = FMath::Min(CompileMin, Sample.CompileTime);
+			FirstPaintTotal += Sample.FirstPaintTime;
+			PaintTotal += Sample.PaintTime;
+		}
+
+		// Counters are the same on every iteration apart from caches warming up, the last one is reported.
+		// Runs of virtualized entries only count the lines materialized for the viewport.
+		const FSample& Last = Samples.Last();
+		CsvLines.Add(FString::Printf(TEXT("%s,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%d,%d,%d"),
+			*Entry.Name, Entry.Text.Len(), NumLines, Iterations,
+			CompileTotal * 1000.0 / Iterations, CompileMin * 1000.0, FirstPaintTotal * 1000.0 / Iterations, PaintTotal * 1000.0 / Iterations,
+			Last.Runs, Last.NewMIDs, Last.NewObjects));
+
+		Unlog::Displayf(TEXT("ExpressiveTextBenchmark: %s"), *CsvLines.Last());
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(CsvLines, *OutputPath))
+	{
+		Unlog::Errorf(TEXT("ExpressiveTextBenchmark: Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	Unlog::Displayf(TEXT("ExpressiveTextBenchmark: Wrote %s"), *FPaths::ConvertRelativePathToFull(OutputPath));
+	return 0;
+}
@@ -0,0 +1,22 @@
+// Copyright 2022 Guganana. All Rights Reserved.
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+
+#include "ExpressiveTextBenchmarkCommandlet.generated.h"
+
+// Compiles, lays out and paints a generated corpus of texts and writes the timings and counters to a csv.
+// The corpus and the reveal time steps are fixed so runs of different versions can be diffed.
+//
+// Usage: UnrealEditor-Cmd <Project> -run=ExpressiveTextBenchmark -nullrhi [-Iterations=5] [-Frames=60] [-Width=1280] [-Height=720] [-Output=<File>]
+UCLASS()
+class EXPRESSIVETEXTEDITOR_API UExpressiveTextBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UExpressiveTextBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
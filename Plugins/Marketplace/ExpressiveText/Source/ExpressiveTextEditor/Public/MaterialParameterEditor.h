@@ -9,7 +9,13 @@
 #include <Materials/MaterialInstance.h>
 #include <Kismet/BlueprintFunctionLibrary.h>
 #include <Blueprint/UserWidget.h>
+#include <Components/TextBlock.h>
 #include <MaterialEditingLibrary.h>
+#include <EditorSubsystem.h>
+#include <Editor.h>
+#include <TickableEditorObject.h>
+#include <Materials/MaterialInstanceDynamic.h>
+#include <ScopedTransaction.h>
 
 #include <ExpressiveText/Public/Asset/ExpressiveTextMaterial.h>
 
@@ -245,6 +251,219 @@ public:
    
 };
 
+// Batches the edits made through the material parameter widgets.
+// While edits arrive only the preview is updated and the values are recorded, once the material hasn't been edited for
+// SettleDelay they are all written in one undo transaction, with a single permutation update (plus PostEditChange).
+UCLASS()
+class UExTextMaterialParameterEditSubsystem : public UEditorSubsystem, public FTickableEditorObject
+{
+    GENERATED_BODY()
+
+public:
+
+    // Seconds without edits before the pending changes of a material are committed
+    static constexpr double SettleDelay = 0.35;
+
+    static UExTextMaterialParameterEditSubsystem* Get()
+    {
+        return GEditor ? GEditor->GetEditorSubsystem<UExTextMaterialParameterEditSubsystem>() : nullptr;
+    }
+
+    // Dynamic instance parented to Material that receives value edits immediately, created on first use
+    UMaterialInstanceDynamic* GetPreviewMaterial(UMaterialInstanceConstant* Material)
+    {
+        if (!Material)
+        {
+            return nullptr;
+        }
+
+        UMaterialInstanceDynamic*& Preview = PreviewMaterials.FindOrAdd(Material);
+        if (!Preview)
+        {
+            Preview = UMaterialInstanceDynamic::Create(Material, this);
+        }
+
+        return Preview;
+    }
+
+    UMaterialInstanceDynamic* FindPreviewMaterial(UMaterialInstanceConstant* Material) const
+    {
+        auto* const* Found = PreviewMaterials.Find(Material);
+        return Found ? *Found : nullptr;
+    }
+
+    // Values recorded for Material, they are written when the edits are committed
+    void SetPendingScalarValue(UMaterialInstanceConstant* Material, const FMaterialParameterInfo& ParameterInfo, float Value)
+    {
+        PendingEdits.FindOrAdd(Material).ScalarValues.Add(ParameterInfo, Value);
+    }
+
+    void SetPendingVectorValue(UMaterialInstanceConstant* Material, const FMaterialParameterInfo& ParameterInfo, const FLinearColor& Value)
+    {
+        PendingEdits.FindOrAdd(Material).VectorValues.Add(ParameterInfo, Value);
+    }
+
+    void SetPendingTextureValue(UMaterialInstanceConstant* Material, const FMaterialParameterInfo& ParameterInfo, UTexture* Value)
+    {
+        PendingEdits.FindOrAdd(Material).TextureValues.Add(ParameterInfo, Value);
+    }
+
+    // Static parameters to edit for Material, shared by every static edit until the material is committed
+    FStaticParameterSet& GetPendingStaticParameters(UMaterialInstanceConstant* Material)
+    {
+        FPendingEdit& Pending = PendingEdits.FindOrAdd(Material);
+        if (!Pending.StaticParameters.IsSet())
+        {
+            Pending.StaticParameters.Emplace();
+            Material->GetStaticParameterValues(Pending.StaticParameters.GetValue());
+        }
+
+        return Pending.StaticParameters.GetValue();
+    }
+
+    void QueueCommit(UMaterialInstanceConstant* Material)
+    {
+        PendingEdits.FindOrAdd(Material).LastEditTime = FPlatformTime::Seconds();
+    }
+
+    void Flush(UMaterialInstanceConstant* Material)
+    {
+        FPendingEdit Pending;
+        if (PendingEdits.RemoveAndCopyValue(Material, Pending))
+        {
+            Commit(Material, Pending);
+        }
+    }
+
+    void FlushAll()
+    {
+        TMap<TWeakObjectPtr<UMaterialInstanceConstant>, FPendingEdit> ToCommit = MoveTemp(PendingEdits);
+        PendingEdits.Reset();
+
+        for (auto& Entry : ToCommit)
+        {
+            if (auto* Material = Entry.Key.Get())
+            {
+                Commit(Material, Entry.Value);
+            }
+        }
+    }
+
+    void UpdateStaticPermutation(UMaterialInstanceConstant* Material, FStaticParameterSet& StaticParameters)
+    {
+        Material->UpdateStaticPermutation(StaticParameters);
+        Material->InitStaticPermutation();
+        StaticPermutationUpdates++;
+    }
+
+    int32 GetStaticPermutationUpdates() const
+    {
+        return StaticPermutationUpdates;
+    }
+
+    virtual void Deinitialize() override
+    {
+        FlushAll();
+        PreviewMaterials.Reset();
+        Super::Deinitialize();
+    }
+
+    virtual void Tick(float DeltaTime) override
+    {
+        const double Now = FPlatformTime::Seconds();
+
+        TArray<TWeakObjectPtr<UMaterialInstanceConstant>, TInlineAllocator<4>> Settled;
+        for (const auto& Entry : PendingEdits)
+        {
+            if (Now - Entry.Value.LastEditTime >= SettleDelay)
+            {
+                Settled.Add(Entry.Key);
+            }
+        }
+
+        for (const auto& WeakMaterial : Settled)
+        {
+            FPendingEdit Pending;
+            PendingEdits.RemoveAndCopyValue(WeakMaterial, Pending);
+            if (auto* Material = WeakMaterial.Get())
+            {
+                Commit(Material, Pending);
+            }
+        }
+    }
+
+    virtual bool IsTickable() const override
+    {
+        return PendingEdits.Num() > 0;
+    }
+
+    virtual TStatId GetStatId() const override
+    {
+        RETURN_QUICK_DECLARE_CYCLE_STAT(UExTextMaterialParameterEditSubsystem, STATGROUP_Tickables);
+    }
+
+private:
+
+    struct FPendingEdit
+    {
+        TMap<FMaterialParameterInfo, float> ScalarValues;
+        TMap<FMaterialParameterInfo, FLinearColor> VectorValues;
+        TMap<FMaterialParameterInfo, TWeakObjectPtr<UTexture>> TextureValues;
+        TOptional<FStaticParameterSet> StaticParameters;
+        double LastEditTime = 0.0;
+    };
+
+    void Commit(UMaterialInstanceConstant* Material, FPendingEdit& Pending)
+    {
+        {
+            // Nothing was written to the material before this, so Modify records it as it was before the interaction
+            const FScopedTransaction Transaction(NSLOCTEXT("ExpressiveTextEditor", "EditMaterialParameters", "Edit Material Parameters"));
+            Material->Modify();
+
+            for (const auto& Entry : Pending.ScalarValues)
+            {
+                Material->SetScalarParameterValueEditorOnly(Entry.Key, Entry.Value);
+            }
+
+            for (const auto& Entry : Pending.VectorValues)
+            {
+                Material->SetVectorParameterValueEditorOnly(Entry.Key, Entry.Value);
+            }
+
+            for (const auto& Entry : Pending.TextureValues)
+            {
+                Material->SetTextureParameterValueEditorOnly(Entry.Key, Entry.Value.Get());
+            }
+
+            if (Pending.StaticParameters.IsSet())
+            {
+                UpdateStaticPermutation(Material, Pending.StaticParameters.GetValue());
+            }
+
+#if WITH_EDITOR
+            Material->PostEditChange();
+#endif
+        }
+
+        // Previews only live for one interaction, the committed material shows the edits from here on
+        PreviewMaterials.Remove(Material);
+        for (auto It = PreviewMaterials.CreateIterator(); It; ++It)
+        {
+            if (!It.Key() || !It.Value())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    TMap<TWeakObjectPtr<UMaterialInstanceConstant>, FPendingEdit> PendingEdits;
+
+    UPROPERTY(Transient)
+    TMap<UMaterialInstanceConstant*, UMaterialInstanceDynamic*> PreviewMaterials;
+
+    int32 StaticPermutationUpdates = 0;
+};
+
 UCLASS()
 class UExTextMaterialParameterEditWidgetBase : public UUserWidget
 {
@@ -293,50 +512,155 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Expressive Text Editor")
     void Setup_Blueprint();
     
+    // Applies the edit right away, static parameters update the permutation of Material immediately
     void UpdateMaterial(UMaterialInstanceConstant* Material)
     {
         if (Material && ParameterInfos.Num() > 0)
         {
-            UpdateMaterial_Impl(Material);
+            const FScopedTransaction Transaction(NSLOCTEXT("ExpressiveTextEditor", "EditMaterialParameter", "Edit Material Parameter"));
+            Material->Modify();
+
+            if (IsStaticParameter())
+            {
+                FStaticParameterSet Parameters;
+                Material->GetStaticParameterValues(Parameters);
+                if (UpdateStaticParameters_Impl(Parameters))
+                {
+                    if (auto* Subsystem = UExTextMaterialParameterEditSubsystem::Get())
+                    {
+                        Subsystem->UpdateStaticPermutation(Material, Parameters);
+#if WITH_EDITOR
+                        Material->PostEditChange();
+#endif
+                    }
+                }
+            }
+            else
+            {
+                UpdateMaterial_Impl(Material);
+            }
         }
     }
 
+    // Static parameters require a new shader permutation so their edits are batched instead of applied directly
+    virtual bool IsStaticParameter() const
+    {
+        return false;
+    }
+
     virtual void UpdateMaterial_Impl(UMaterialInstanceConstant* Material)
     {
     }
 
+    virtual void UpdatePreview_Impl(UMaterialInstanceDynamic* Preview)
+    {
+    }
 
+    // Records the edit in Subsystem so it is written to Material when the edits are committed
+    virtual void QueueValue_Impl(UExTextMaterialParameterEditSubsystem& Subsystem, UMaterialInstanceConstant* Material)
+    {
+    }
+
+    // Writes the edit into Parameters, returns whether the permutation needs updating
+    virtual bool UpdateStaticParameters_Impl(FStaticParameterSet& Parameters)
+    {
+        return false;
+    }
+
+    // Called on every edit tick: values reach the preview immediately and are recorded, the material itself is only
+    // written once the interaction settles, in one transaction and with static changes coalesced into one permutation update
     UFUNCTION(BlueprintCallable, Category = "Expressive Text Editor")
     static void UpdateMaterialWithDirtyParameters(UMaterialInstanceConstant* Material, const TArray<UExTextMaterialParameterEditWidgetBase*>& Parameters)
     {
+        auto* Subsystem = UExTextMaterialParameterEditSubsystem::Get();
+        if (!Material || !Subsystem)
+        {
+            return;
+        }
+
+        UMaterialInstanceDynamic* Preview = Subsystem->FindPreviewMaterial(Material);
+
         bool AnyDirty = false;
         for (auto& Parameter : Parameters)
         {
-            if (Parameter->IsDirty())
+            if (!Parameter || !Parameter->IsDirty() || Parameter->ParameterInfos.Num() == 0)
+            {
+                continue;
+            }
+
+            AnyDirty = true;
+
+            if (Parameter->IsStaticParameter())
             {
-                AnyDirty = true;
-                Parameter->UpdateMaterial(Material);
+                Parameter->UpdateStaticParameters_Impl(Subsystem->GetPendingStaticParameters(Material));
+            }
+            else
+            {
+                Parameter->QueueValue_Impl(*Subsystem, Material);
+                if (Preview)
+                {
+                    Parameter->UpdatePreview_Impl(Preview);
+                }
             }
         }
 
         if (AnyDirty)
         {
-            FStaticParameterSet NewStaticParameters;
-            Material->GetStaticParameterValues(NewStaticParameters);
-            Material->UpdateStaticPermutation(NewStaticParameters);
-            //Material->InitStaticPermutation();
+            Subsystem->QueueCommit(Material);
+        }
+    }
 
-#if WITH_EDITOR
-            Material->Modify();
-            Material->PostEditChange();
-            //UMaterialEditingLibrary::RecompileMaterial(Material->GetMaterial());
-#endif
+    // Commits the pending edits of Material without waiting for them to settle, e.g. when a slider is released
+    UFUNCTION(BlueprintCallable, Category = "Expressive Text Editor")
+    static void FlushMaterialParameterEdits(UMaterialInstanceConstant* Material)
+    {
+        if (auto* Subsystem = UExTextMaterialParameterEditSubsystem::Get())
+        {
+            Subsystem->Flush(Material);
         }
     }
 
+    UFUNCTION(BlueprintCallable, Category = "Expressive Text Editor")
+    static UMaterialInstanceDynamic* GetMaterialParameterPreview(UMaterialInstanceConstant* Material)
+    {
+        auto* Subsystem = UExTextMaterialParameterEditSubsystem::Get();
+        return Subsystem ? Subsystem->GetPreviewMaterial(Material) : nullptr;
+    }
+
+    // Number of shader permutation updates triggered by parameter edits in this editor session
+    UFUNCTION(BlueprintPure, Category = "Expressive Text Editor")
+    static int32 GetStaticPermutationUpdateCount()
+    {
+        auto* Subsystem = UExTextMaterialParameterEditSubsystem::Get();
+        return Subsystem ? Subsystem->GetStaticPermutationUpdates() : 0;
+    }
+
+    UFUNCTION()
+    FText GetStaticPermutationUpdatesText() const
+    {
+        return FText::Format(NSLOCTEXT("ExpressiveTextEditor", "StaticPermutationUpdates", "Permutation updates: {0}"), GetStaticPermutationUpdateCount());
+    }
+
     UPROPERTY(BlueprintReadWrite, Category = "Material Parameters")
     TArray<FMaterialParameterInfo> ParameterInfos;
 
+protected:
+
+    virtual void NativeConstruct() override
+    {
+        Super::NativeConstruct();
+
+        if (StaticPermutationUpdatesText)
+        {
+            StaticPermutationUpdatesText->TextDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UExTextMaterialParameterEditWidgetBase, GetStaticPermutationUpdatesText));
+            StaticPermutationUpdatesText->SynchronizeProperties();
+        }
+    }
+
+    // Shows how many permutation updates the edits caused, widgets that don't have one simply skip it
+    UPROPERTY(BlueprintReadOnly, Category = "Material Parameters", meta = (BindWidgetOptional))
+    UTextBlock* StaticPermutationUpdatesText;
+
 };
 
 UCLASS()
@@ -374,6 +698,17 @@ public:
         LastValue = Value;
     }
 
+    virtual void QueueValue_Impl(UExTextMaterialParameterEditSubsystem& Subsystem, UMaterialInstanceConstant* Material) override
+    {
+        Subsystem.SetPendingScalarValue(Material, ParameterInfos[0], Value);
+        LastValue = Value;
+    }
+
+    virtual void UpdatePreview_Impl(UMaterialInstanceDynamic* Preview) override
+    {
+        Preview->SetScalarParameterValueByInfo(ParameterInfos[0], Value);
+    }
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Parameters")
     float Default;
 
@@ -429,6 +764,17 @@ public:
         LastValue = Value;
     }
 
+    virtual void QueueValue_Impl(UExTextMaterialParameterEditSubsystem& Subsystem, UMaterialInstanceConstant* Material) override
+    {
+        Subsystem.SetPendingVectorValue(Material, ParameterInfos[0], Value);
+        LastValue = Value;
+    }
+
+    virtual void UpdatePreview_Impl(UMaterialInstanceDynamic* Preview) override
+    {
+        Preview->SetVectorParameterValueByInfo(ParameterInfos[0], Value);
+    }
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Parameters")
     FLinearColor Value;
     FLinearColor LastValue;
@@ -472,6 +818,17 @@ public:
         LastValue = Value;
     }
 
+    virtual void QueueValue_Impl(UExTextMaterialParameterEditSubsystem& Subsystem, UMaterialInstanceConstant* Material) override
+    {
+        Subsystem.SetPendingTextureValue(Material, ParameterInfos[0], Value);
+        LastValue = Value;
+    }
+
+    virtual void UpdatePreview_Impl(UMaterialInstanceDynamic* Preview) override
+    {
+        Preview->SetTextureParameterValueByInfo(ParameterInfos[0], Value);
+    }
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Parameters")
     UTexture* Value;
     UTexture* LastValue;
@@ -509,10 +866,15 @@ public:
         Material->GetStaticSwitchParameterDefaultValue(ParameterInfos[0], Default, Id);
     }
 
-    virtual void UpdateMaterial_Impl(UMaterialInstanceConstant* Material) override
+    virtual bool IsStaticParameter() const override
+    {
+        return true;
+    }
+
+    virtual bool UpdateStaticParameters_Impl(FStaticParameterSet& Parameters) override
     {
-        FStaticParameterSet Parameters;
-        Material->GetStaticParameterValues(Parameters);
+        bool Changed = false;
+
         auto& StaticSwitchParameters = Guganana::Engine::GetStaticSwitchParameters(Parameters);
         if (auto* FoundSwitch = StaticSwitchParameters.FindByPredicate([this](const auto& Switch) { return Switch.ParameterInfo == ParameterInfos[0]; }))
         {
@@ -520,12 +882,12 @@ public:
             {
                 FoundSwitch->Value = Value;
                 FoundSwitch->bOverride = true;
-                Material->UpdateStaticPermutation(Parameters);
-                Material->InitStaticPermutation();
+                Changed = true;
             }
         }
 
         LastValue = Value;
+        return Changed;
     }
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Parameters")
@@ -587,12 +949,15 @@ public:
     }
 
 
-    virtual void UpdateMaterial_Impl(UMaterialInstanceConstant* Material) override
+    virtual bool IsStaticParameter() const override
     {
-        FString ValueName = StaticEnum<EExText_MaterialMappingOptions>()->GetNameStringByIndex(static_cast<int32>(Value));
+        return true;
+    }
 
-        FStaticParameterSet Parameters;
-        Material->GetStaticParameterValues(Parameters);
+    virtual bool UpdateStaticParameters_Impl(FStaticParameterSet& Parameters) override
+    {
+        bool Changed = false;
+        FString ValueName = StaticEnum<EExText_MaterialMappingOptions>()->GetNameStringByIndex(static_cast<int32>(Value));
 
         const int32 WorkingLayerIndex = ParameterInfos[0].Index;
 
@@ -621,12 +986,12 @@ public:
 
                 FoundSwitch->Value = true;
                 FoundSwitch->bOverride = true;
-                Material->UpdateStaticPermutation(Parameters);
-                Material->InitStaticPermutation();
+                Changed = true;
             }
         }
 
         LastValue = Value;
+        return Changed;
     }
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Parameters")